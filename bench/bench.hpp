@@ -0,0 +1,193 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <streambuf>
+#include <vector>
+
+namespace bench
+{
+
+// Iteration state passed to benchmark functions. Only the loop
+// is timed, setup code before the loop is not:
+//
+//     void my_benchmark(bench::State& state) {
+//         setup();
+//         while (state.keep_running())
+//             work();
+//     }
+class State {
+public:
+    explicit State(std::size_t iterations)
+        : iterations_(iterations)
+        {}
+
+    bool keep_running() {
+        if (remaining_ == iterations_)
+            start_ = clock::now();
+
+        if (remaining_) {
+            --remaining_;
+            return true;
+        }
+
+        stop_ = clock::now();
+        return false;
+    }
+
+    std::size_t iterations() const {
+        return iterations_;
+    }
+
+    // Amount of data processed, for throughput reporting
+    void add_bytes(std::size_t bytes) {
+        bytes_ += bytes;
+    }
+
+    std::size_t bytes() const {
+        return bytes_;
+    }
+
+    double elapsed() const {
+        return std::chrono::duration<double>(stop_ - start_).count();
+    }
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    std::size_t iterations_;
+    std::size_t remaining_ = iterations_;
+    std::size_t bytes_ = 0;
+    clock::time_point start_, stop_;
+};
+
+using Function = void (*)(State&);
+
+struct Benchmark {
+    char const* name;
+    Function function;
+};
+
+inline std::vector<Benchmark>& registry() {
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+struct Registrar {
+    Registrar(char const* name, Function function) {
+        registry().push_back({ name, function });
+    }
+};
+
+#define BENCHMARK(fn) static ::bench::Registrar fn##_registrar(#fn, fn)
+
+// Prevent the compiler from optimizing away computations
+template<typename T>
+inline void do_not_optimize(T const& value) {
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile char sink;
+    sink = *reinterpret_cast<char const volatile*>(&value);
+#endif
+}
+
+// Pseudo-random numbers for benchmark datasets. A linear congruential
+// generator rather than <random> distributions, whose output differs
+// between standard libraries: a given seed yields the same data
+// everywhere, so results are comparable across machines.
+class Random {
+public:
+    explicit Random(std::uint32_t seed = 12345)
+        : state_(seed)
+        {}
+
+    std::uint32_t next() {
+        state_ = state_*1664525u + 1013904223u;
+        return state_;
+    }
+
+    // Uniform in [0, 1)
+    float uniform() {
+        return float(next() >> 8)/float(1u << 24);
+    }
+
+    // Uniform in [lo, hi). The range must not be empty,
+    // and hi - lo must fit 24 bits
+    long range(long lo, long hi) {
+        assert(hi > lo && hi - lo <= (1l << 24));
+        return lo + long((next() >> 8) % std::uint32_t(hi - lo));
+    }
+
+private:
+    std::uint32_t state_;
+};
+
+// Stream buffer discarding its input, counting written bytes
+class NullBuffer : public std::streambuf {
+public:
+    std::size_t count() const {
+        return count_;
+    }
+
+    void reset() {
+        count_ = 0;
+    }
+
+protected:
+    int_type overflow(int_type ch) override {
+        ++count_;
+        return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(char const*, std::streamsize n) override {
+        count_ += std::size_t(n);
+        return n;
+    }
+
+private:
+    std::size_t count_ = 0;
+};
+
+class NullStream : public std::ostream {
+public:
+    NullStream()
+        : std::ostream(&buffer_)
+        {}
+
+    NullBuffer& buffer() {
+        return buffer_;
+    }
+
+private:
+    NullBuffer buffer_;
+};
+
+} /* namespace bench */
@@ -0,0 +1,357 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "bench.hpp"
+
+#include <plot.hpp>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+using namespace plot;
+
+namespace
+{
+
+char const* const sample_text = "t=12.50s  y=-0.4375\nmin 0.001  max 1e+06";
+
+void run_text(bench::State& state, Point origin) {
+    BrailleCanvas canvas({ 80, 24 }, TerminalInfo(STDOUT_FILENO, TerminalMode::Iso24bit));
+
+    while (state.keep_running()) {
+        for (Coord y = 0; y < 80; y += 16)
+            canvas.text(palette::white, origin + Point(0, y), sample_text);
+        bench::do_not_optimize(canvas);
+    }
+}
+
+void canvas_text_aligned(bench::State& state) {
+    run_text(state, { 2, 4 });
+}
+BENCHMARK(canvas_text_aligned);
+
+void canvas_text_unaligned(bench::State& state) {
+    run_text(state, { 3, 5 });
+}
+BENCHMARK(canvas_text_unaligned);
+
+// Random segments across the whole canvas
+std::vector<std::pair<Point, Point>> const& stroke_segments() {
+    static std::vector<std::pair<Point, Point>> segments = [] {
+        std::vector<std::pair<Point, Point>> result(256);
+        bench::Random random(42);
+        for (auto& s: result) {
+            s.first = { random.range(0, 160), random.range(0, 96) };
+            s.second = { random.range(0, 160), random.range(0, 96) };
+        }
+        return result;
+    }();
+    return segments;
+}
+
+void canvas_stroke_lines(bench::State& state) {
+    BrailleCanvas canvas({ 80, 24 }, TerminalInfo(STDOUT_FILENO, TerminalMode::Iso24bit));
+    auto const& segments = stroke_segments();
+
+    while (state.keep_running()) {
+        canvas.clear();
+        for (auto const& s: segments)
+            canvas.line(palette::white, s.first, s.second);
+        bench::do_not_optimize(canvas);
+    }
+}
+BENCHMARK(canvas_stroke_lines);
+
+void canvas_fill_ellipses(bench::State& state) {
+    BrailleCanvas canvas({ 80, 24 }, TerminalInfo(STDOUT_FILENO, TerminalMode::Iso24bit));
+
+    while (state.keep_running()) {
+        canvas.clear();
+        for (Coord i = 0; i < 8; ++i)
+            canvas.ellipse(palette::white, palette::blue, { 20 + 15*i, 48 }, { 18, 8 + 4*i });
+        bench::do_not_optimize(canvas);
+    }
+}
+BENCHMARK(canvas_fill_ellipses);
+
+// Many small shapes on a large canvas: markers, glyphs and the like
+void canvas_small_shapes(bench::State& state) {
+    BrailleCanvas canvas({ 240, 80 }, TerminalInfo(STDOUT_FILENO, TerminalMode::Iso24bit));
+
+    std::vector<Point> centers(128);
+    bench::Random random(7);
+    for (auto& c: centers)
+        c = { random.range(4, 476), random.range(4, 316) };
+
+    while (state.keep_running()) {
+        canvas.clear();
+        for (auto const& c: centers) {
+            canvas.rect(palette::white, palette::blue, { c - Point(3, 3), c + Point(3, 3) });
+            canvas.ellipse(palette::yellow, c, { 2, 2 });
+            canvas.path(palette::red, { c - Point(4, 0), c + Point(0, 4), c + Point(4, 0) });
+        }
+        bench::do_not_optimize(canvas);
+    }
+}
+BENCHMARK(canvas_small_shapes);
+
+// Composite layers with clipping operators
+void canvas_layers_clip(bench::State& state) {
+    BrailleCanvas canvas({ 80, 24 }, TerminalInfo(STDOUT_FILENO, TerminalMode::Iso24bit));
+
+    while (state.keep_running()) {
+        canvas.clear();
+        for (Coord i = 0; i < 16; ++i) {
+            canvas.push()
+                  .fill(palette::white, { { i, 0 }, { 159 - i, 95 } }, [i](Point p) {
+                      return (p.x + p.y + i) % 3 != 0;
+                  })
+                  .pop((i % 2) ? TerminalOp::ClipDst : TerminalOp::ClipSrc);
+        }
+        bench::do_not_optimize(canvas);
+    }
+}
+BENCHMARK(canvas_layers_clip);
+
+// Composite translucent layers: every cell is blended at each pop
+void canvas_layers_blend(bench::State& state) {
+    BrailleCanvas canvas({ 80, 24 }, TerminalInfo(STDOUT_FILENO, TerminalMode::Iso24bit));
+
+    while (state.keep_running()) {
+        canvas.clear();
+        for (Coord i = 0; i < 16; ++i) {
+            auto color = Color(float(i % 3)/2.0f, float(i % 5)/4.0f, float(i % 7)/6.0f, 0.5f);
+            canvas.push()
+                  .fill(color, { { i, 0 }, { 159 - i, 95 } }, [i](Point p) {
+                      return (p.x + p.y + i) % 3 != 0;
+                  })
+                  .pop();
+        }
+        bench::do_not_optimize(canvas);
+    }
+}
+BENCHMARK(canvas_layers_blend);
+
+// Serialize an 80x24 canvas of horizontal color bands, with an area
+// filled with cell backgrounds and a line stroked over it
+void canvas_render(bench::State& state, TerminalMode mode) {
+    BrailleCanvas canvas({ 80, 24 }, TerminalInfo(STDOUT_FILENO, mode));
+    canvas.fill_backgrounds(true);
+
+    for (Coord y = 0; y < 96; y += 8)
+        canvas.line(Color(float(y)/96.0f, 0.5f, 1.0f - float(y)/96.0f), { 0, y }, { 159, y });
+
+    canvas.fill(palette::blue, { { 40, 24 }, { 119, 71 } }, [](Point) { return true; })
+          .line(palette::red, { 40, 24 }, { 119, 71 });
+
+    bench::NullStream stream;
+
+    while (state.keep_running())
+        stream << canvas;
+
+    state.add_bytes(stream.buffer().count());
+}
+
+void canvas_render_ansi256(bench::State& state) {
+    canvas_render(state, TerminalMode::Ansi256);
+}
+BENCHMARK(canvas_render_ansi256);
+
+void canvas_render_24bit(bench::State& state) {
+    canvas_render(state, TerminalMode::Iso24bit);
+}
+BENCHMARK(canvas_render_24bit);
+
+// Long history, one sample per pixel column
+std::vector<Point> const& history_points() {
+    static std::vector<Point> points = [] {
+        std::vector<Point> result(20000);
+        bench::Random random(3);
+        Coord y = 24;
+        for (std::size_t x = 0; x < result.size(); ++x) {
+            y = utils::clamp(y + random.range(-2, 3), Coord(0), Coord(47));
+            result[x] = { Coord(x), y };
+        }
+        return result;
+    }();
+    return points;
+}
+
+void canvas_long_path(bench::State& state) {
+    BrailleCanvas canvas({ 10000, 12 }, TerminalInfo(STDOUT_FILENO, TerminalMode::Iso24bit));
+    auto const& points = history_points();
+
+    while (state.keep_running()) {
+        canvas.clear();
+        canvas.path(palette::white, points.begin(), points.end());
+        bench::do_not_optimize(canvas);
+    }
+}
+BENCHMARK(canvas_long_path);
+
+void tiled_canvas_long_path(bench::State& state) {
+    TiledCanvas canvas({ 10000, 12 });
+    auto const& points = history_points();
+
+    while (state.keep_running()) {
+        canvas.clear();
+        canvas.path(palette::white, points.begin(), points.end());
+        bench::do_not_optimize(canvas);
+    }
+}
+BENCHMARK(tiled_canvas_long_path);
+
+// Render a window of a long history
+void tiled_canvas_view(bench::State& state) {
+    TiledCanvas canvas({ 10000, 12 });
+    auto const& points = history_points();
+    canvas.path(palette::white, points.begin(), points.end());
+
+    BrailleCanvas viewport({ 80, 12 }, TerminalInfo(STDOUT_FILENO, TerminalMode::Iso24bit));
+    bench::NullStream stream;
+    Coord col = 0;
+
+    while (state.keep_running()) {
+        stream << canvas.view(viewport, { col, 0 });
+        col = (col + 97) % 9920;
+    }
+}
+BENCHMARK(tiled_canvas_view);
+
+void real_canvas_fill(bench::State& state) {
+    RealCanvas<BrailleCanvas> canvas({ { -1.0f, 1.0f }, { 1.0f, -1.0f } }, Size(80, 24),
+                                     TerminalInfo(STDOUT_FILENO, TerminalMode::Iso24bit));
+
+    while (state.keep_running()) {
+        canvas.fill(palette::white, canvas.bounds(), [](Pointf p) {
+            return p.x*p.x + p.y*p.y < 0.8f;
+        });
+        bench::do_not_optimize(canvas);
+    }
+}
+BENCHMARK(real_canvas_fill);
+
+void real_canvas_map_batch(bench::State& state) {
+    RealCanvas<BrailleCanvas> canvas({ { 0.0f, 1.0f }, { 1.0f, 0.0f } }, Size(80, 24));
+
+    std::vector<Pointf> points(4096);
+    for (std::size_t i = 0; i < points.size(); ++i)
+        points[i] = { float(i)/points.size(), float(i % 97)/97.0f };
+
+    std::vector<Point> pixels(points.size());
+
+    while (state.keep_running()) {
+        canvas.map(points.begin(), points.end(), pixels.begin());
+        bench::do_not_optimize(pixels);
+    }
+}
+BENCHMARK(real_canvas_map_batch);
+
+std::vector<Pointf> const& scatter_points() {
+    static std::vector<Pointf> points = [] {
+        std::vector<Pointf> result(500000);
+        bench::Random random;
+        for (auto& p: result)
+            p = { random.uniform() + random.uniform() - 1.0f, random.uniform() + random.uniform() - 1.0f };
+        return result;
+    }();
+    return points;
+}
+
+void real_canvas_dot_loop(bench::State& state) {
+    RealCanvas<BrailleCanvas> canvas({ { -1.0f, 1.0f }, { 1.0f, -1.0f } }, Size(80, 24));
+    auto const& points = scatter_points();
+
+    while (state.keep_running()) {
+        canvas.clear();
+        for (auto const& p: points)
+            canvas.dot(palette::white, p);
+        bench::do_not_optimize(canvas);
+    }
+}
+BENCHMARK(real_canvas_dot_loop);
+
+void real_canvas_scatter(bench::State& state) {
+    RealCanvas<BrailleCanvas> canvas({ { -1.0f, 1.0f }, { 1.0f, -1.0f } }, Size(80, 24));
+    auto const& points = scatter_points();
+
+    while (state.keep_running()) {
+        canvas.clear().scatter(palette::white, points.begin(), points.end());
+        bench::do_not_optimize(canvas);
+    }
+}
+BENCHMARK(real_canvas_scatter);
+
+void density_canvas_add_paint(bench::State& state) {
+    RealCanvas<DensityCanvas> density({ { -1.0f, 1.0f }, { 1.0f, -1.0f } }, Size(80, 24));
+    BrailleCanvas canvas({ 80, 24 });
+    auto const& points = scatter_points();
+
+    while (state.keep_running()) {
+        density.canvas().clear();
+        density.add(points.begin(), points.end());
+        density.canvas().paint(canvas.clear(), [](float t) {
+            return Color(t, 0.0f, 1.0f - t);
+        });
+        bench::do_not_optimize(canvas);
+    }
+}
+BENCHMARK(density_canvas_add_paint);
+
+// Write an 80x24 heatmap of background-colored cells in 256-color mode
+template<typename Setter>
+void run_heatmap(bench::State& state, Setter&& setter) {
+    bench::NullStream stream;
+
+    while (state.keep_running()) {
+        for (int y = 0; y < 24; ++y) {
+            for (int x = 0; x < 80; ++x)
+                stream << setter(float((x*7 + y*13) % 97)/96.0f) << ' ';
+            stream << '\n';
+        }
+    }
+
+    state.add_bytes(stream.buffer().count());
+}
+
+void heatmap_colormap_color(bench::State& state) {
+    TerminalInfo term(STDOUT_FILENO, TerminalMode::Ansi256);
+    auto const& map = Colormap::viridis();
+    run_heatmap(state, [&term,&map](float t) {
+        return term.background(map(t));
+    });
+}
+BENCHMARK(heatmap_colormap_color);
+
+void heatmap_colormap_precomputed(bench::State& state) {
+    TerminalInfo term(STDOUT_FILENO, TerminalMode::Ansi256);
+    auto const& map = Colormap::viridis();
+    run_heatmap(state, [&term,&map](float t) {
+        return term.background(map.terminal_color(t));
+    });
+}
+BENCHMARK(heatmap_colormap_precomputed);
+
+} /* namespace */
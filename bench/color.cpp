@@ -0,0 +1,81 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "bench.hpp"
+
+#include <plot.hpp>
+
+#include <vector>
+
+using namespace plot;
+
+namespace
+{
+
+std::vector<Color> const& random_colors() {
+    static std::vector<Color> colors = [] {
+        std::vector<Color> result(4096);
+        bench::Random random(7);
+        for (auto& c: result)
+            c = { random.uniform(), random.uniform(), random.uniform(), random.uniform() };
+        return result;
+    }();
+    return colors;
+}
+
+void color_find_color(bench::State& state) {
+    auto const& colors = random_colors();
+
+    while (state.keep_running()) {
+        for (auto const& c: colors)
+            bench::do_not_optimize(ansi::detail::find_color(c));
+    }
+}
+BENCHMARK(color_find_color);
+
+void color_find_color256(bench::State& state) {
+    auto const& colors = random_colors();
+
+    while (state.keep_running()) {
+        for (auto const& c: colors)
+            bench::do_not_optimize(ansi::detail::find_color256(c));
+    }
+}
+BENCHMARK(color_find_color256);
+
+void color_fixed_over(bench::State& state) {
+    std::vector<detail::fixed_color> colors;
+    for (auto const& c: random_colors())
+        colors.emplace_back(c);
+
+    while (state.keep_running()) {
+        detail::fixed_color dst(0, 0, 0, 0xFFFF);
+        for (auto const& c: colors)
+            dst = c.over(dst);
+        bench::do_not_optimize(dst);
+    }
+}
+BENCHMARK(color_fixed_over);
+
+} /* namespace */
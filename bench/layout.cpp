@@ -0,0 +1,147 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "bench.hpp"
+
+#include <plot.hpp>
+
+#include <array>
+#include <cmath>
+#include <utility>
+
+using namespace plot;
+
+namespace
+{
+
+constexpr std::size_t panel_rows = 4, panel_columns = 8;
+
+using Panels = std::array<BrailleCanvas, panel_rows*panel_columns>;
+
+TerminalInfo terminal() {
+    return TerminalInfo(STDOUT_FILENO, TerminalMode::Iso24bit);
+}
+
+Panels make_panels() {
+    Panels panels;
+    float t = 0.0f;
+
+    for (auto& canvas: panels) {
+        canvas = BrailleCanvas({ 12, 4 }, terminal());
+
+        Size sz = canvas.size();
+        for (Coord x = 1; x < sz.x; ++x, t += 0.1f)
+            canvas.line(palette::royalblue,
+                        { x - 1, Coord(sz.y*(0.5f + 0.4f*std::sin(t - 0.1f))) },
+                        { x, Coord(sz.y*(0.5f + 0.4f*std::sin(t))) });
+    }
+
+    return panels;
+}
+
+template<std::size_t Row, std::size_t... Column>
+auto static_row(Panels const& panels, std::index_sequence<Column...>) {
+    return hbox(1, frame(&panels[Row*panel_columns + Column], terminal())...);
+}
+
+template<std::size_t... Row>
+auto static_grid(Panels const& panels, std::index_sequence<Row...>) {
+    return margin(0, vbox(0, static_row<Row>(panels, std::make_index_sequence<panel_columns>())...));
+}
+
+void layout_static_grid(bench::State& state) {
+    auto panels = make_panels();
+    auto grid = static_grid(panels, std::make_index_sequence<panel_rows>());
+    bench::NullStream stream;
+
+    while (state.keep_running()) {
+        stream << grid;
+        bench::do_not_optimize(stream);
+    }
+
+    state.add_bytes(stream.buffer().count());
+}
+BENCHMARK(layout_static_grid);
+
+void layout_dynamic_grid(bench::State& state) {
+    auto panels = make_panels();
+    Grid grid(panel_columns, 0, 1);
+    bench::NullStream stream;
+
+    for (auto const& canvas: panels)
+        grid.add(frame(&canvas, terminal()));
+
+    while (state.keep_running()) {
+        stream << grid;
+        bench::do_not_optimize(stream);
+    }
+
+    state.add_bytes(stream.buffer().count());
+}
+BENCHMARK(layout_dynamic_grid);
+
+void layout_dynamic_boxes(bench::State& state) {
+    auto panels = make_panels();
+    DynamicVBox grid(0);
+    bench::NullStream stream;
+
+    for (std::size_t row = 0; row < panel_rows; ++row) {
+        DynamicHBox hbox(1);
+        for (std::size_t col = 0; col < panel_columns; ++col)
+            hbox.add(frame(&panels[row*panel_columns + col], terminal()));
+        grid.add(std::move(hbox));
+    }
+
+    while (state.keep_running()) {
+        stream << grid;
+        bench::do_not_optimize(stream);
+    }
+
+    state.add_bytes(stream.buffer().count());
+}
+BENCHMARK(layout_dynamic_boxes);
+
+void layout_label_table(bench::State& state) {
+    static char const* const words[] = {
+        u8"load", u8"température", u8"42.0 %", u8"東京", u8"ok", u8"latency p99", u8"—", u8"1 234 567"
+    };
+
+    Grid grid(8, 0, 1);
+    bench::NullStream stream;
+
+    for (std::size_t i = 0; i < 1024; ++i)
+        grid.add(label(words[i % 8], Align::Right, 12));
+
+    auto table = frame(u8"Metrics", Align::Center, &grid, terminal());
+
+    while (state.keep_running()) {
+        stream << table;
+        bench::do_not_optimize(stream);
+    }
+
+    state.add_bytes(stream.buffer().count());
+}
+BENCHMARK(layout_label_table);
+
+} /* namespace */
@@ -0,0 +1,155 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "bench.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+
+enum class Format { Table, Csv, Json };
+
+struct Result {
+    char const* name;
+    std::size_t iterations;
+    double ns_per_iter;
+    double mb_per_s;
+};
+
+void usage(char const* program) {
+    std::cerr << "Usage: " << program << " [--format=table|csv|json] [--min-time=SECONDS] [filter]\n"
+              << "  Runs benchmarks whose name contains filter\n";
+}
+
+void print_header(Format format) {
+    switch (format) {
+        case Format::Table:
+            std::cout << std::left << std::setw(40) << "benchmark"
+                      << std::right << std::setw(12) << "iterations"
+                      << std::setw(16) << "ns/iter"
+                      << std::setw(12) << "MB/s" << '\n';
+            break;
+        case Format::Csv:
+            std::cout << "name,iterations,ns_per_iter,mb_per_s\n";
+            break;
+        case Format::Json:
+            std::cout << "{\n  \"benchmarks\": [";
+            break;
+    }
+}
+
+void print_result(Format format, Result const& result, bool first) {
+    switch (format) {
+        case Format::Table:
+            std::cout << std::left << std::setw(40) << result.name
+                      << std::right << std::setw(12) << result.iterations
+                      << std::setw(16) << std::fixed << std::setprecision(1) << result.ns_per_iter
+                      << std::setw(12) << std::setprecision(1) << result.mb_per_s
+                      << std::endl;
+            break;
+        case Format::Csv:
+            std::cout << result.name << ',' << result.iterations << ','
+                      << std::fixed << std::setprecision(1) << result.ns_per_iter << ','
+                      << std::setprecision(1) << result.mb_per_s << std::endl;
+            break;
+        case Format::Json:
+            // Benchmark names are C identifiers: no escaping needed
+            std::cout << (first ? "\n" : ",\n")
+                      << "    { \"name\": \"" << result.name << "\", "
+                      << "\"iterations\": " << result.iterations << ", "
+                      << std::fixed << std::setprecision(1)
+                      << "\"ns_per_iter\": " << result.ns_per_iter << ", "
+                      << "\"mb_per_s\": " << result.mb_per_s << " }" << std::flush;
+            break;
+    }
+}
+
+void print_footer(Format format) {
+    if (format == Format::Json)
+        std::cout << "\n  ]\n}\n";
+}
+
+} /* namespace */
+
+int main(int argc, char* argv[]) {
+    char const* filter = "";
+    Format format = Format::Table;
+    double min_time = 0.25;
+
+    for (int i = 1; i < argc; ++i) {
+        char const* arg = argv[i];
+
+        if (!std::strcmp(arg, "--format=table")) {
+            format = Format::Table;
+        } else if (!std::strcmp(arg, "--format=csv")) {
+            format = Format::Csv;
+        } else if (!std::strcmp(arg, "--format=json")) {
+            format = Format::Json;
+        } else if (!std::strncmp(arg, "--min-time=", 11)) {
+            min_time = std::atof(arg + 11);
+            if (!(min_time > 0.0)) {
+                usage(argv[0]);
+                return 1;
+            }
+        } else if (arg[0] == '-') {
+            usage(argv[0]);
+            return 1;
+        } else {
+            filter = arg;
+        }
+    }
+
+    print_header(format);
+
+    bool first = true;
+    for (auto const& benchmark: bench::registry()) {
+        if (!std::strstr(benchmark.name, filter))
+            continue;
+
+        // Grow iteration count until the run is long enough to be measured
+        std::size_t iterations = 1;
+        for (;;) {
+            bench::State state(iterations);
+            benchmark.function(state);
+
+            auto elapsed = state.elapsed();
+            if (elapsed >= min_time || iterations >= (std::size_t(1) << 30)) {
+                print_result(format, { benchmark.name, iterations, elapsed*1e9/iterations, state.bytes()/elapsed/1e6 }, first);
+                first = false;
+                break;
+            }
+
+            auto scale = (elapsed > 0.0) ? 1.4*min_time/elapsed : 10.0;
+            iterations = std::size_t(iterations*((scale < 10.0) ? scale : 10.0)) + 1;
+        }
+    }
+
+    print_footer(format);
+    return 0;
+}
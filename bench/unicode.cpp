@@ -0,0 +1,115 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "bench.hpp"
+
+#include <plot.hpp>
+
+#include <string>
+
+using namespace plot;
+
+namespace
+{
+
+std::string repeat(char const* text, std::size_t bytes) {
+    std::string str;
+    while (str.size() < bytes)
+        str += text;
+    return str;
+}
+
+std::string const& ascii_text() {
+    static const std::string text = repeat(u8"The quick brown fox jumps over the lazy dog. ", 4096);
+    return text;
+}
+
+std::string const& cjk_text() {
+    static const std::string text = repeat(u8"天地玄黄，宇宙洪荒。日月盈昃，辰宿列张。", 4096);
+    return text;
+}
+
+std::string const& emoji_text() {
+    static const std::string text = repeat(u8"📈 plot 📉 ✨🎉 🚀 data 👍🏽 ", 4096);
+    return text;
+}
+
+// Width computed through interval trees, for comparison
+std::size_t tree_string_width(string_view str) {
+    std::size_t width = 0;
+
+    for (auto it = str.begin(); it != str.end(); it = detail::utf8_next(it, str.end())) {
+        auto cp = detail::utf8_cp(it, str.end());
+        width += detail::unicode_cp_in_tree(cp, detail::unicode_tables<>::zero_width) ? 0 :
+                 detail::unicode_cp_in_tree(cp, detail::unicode_tables<>::double_width) ? 2 : 1;
+    }
+
+    return width;
+}
+
+void run_width(bench::State& state, std::string const& text) {
+    while (state.keep_running())
+        bench::do_not_optimize(utf8_string_width(text));
+
+    state.add_bytes(state.iterations()*text.size());
+}
+
+void run_tree_width(bench::State& state, std::string const& text) {
+    while (state.keep_running())
+        bench::do_not_optimize(tree_string_width(text));
+
+    state.add_bytes(state.iterations()*text.size());
+}
+
+void unicode_width_ascii(bench::State& state) {
+    run_width(state, ascii_text());
+}
+BENCHMARK(unicode_width_ascii);
+
+void unicode_width_cjk(bench::State& state) {
+    run_width(state, cjk_text());
+}
+BENCHMARK(unicode_width_cjk);
+
+void unicode_width_emoji(bench::State& state) {
+    run_width(state, emoji_text());
+}
+BENCHMARK(unicode_width_emoji);
+
+void unicode_tree_width_ascii(bench::State& state) {
+    run_tree_width(state, ascii_text());
+}
+BENCHMARK(unicode_tree_width_ascii);
+
+void unicode_tree_width_cjk(bench::State& state) {
+    run_tree_width(state, cjk_text());
+}
+BENCHMARK(unicode_tree_width_cjk);
+
+void unicode_tree_width_emoji(bench::State& state) {
+    run_tree_width(state, emoji_text());
+}
+BENCHMARK(unicode_tree_width_emoji);
+
+} /* namespace */
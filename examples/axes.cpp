@@ -0,0 +1,104 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "plot.hpp"
+
+#include "iterators.hpp"
+
+#include <cmath>
+#include <csignal>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+using namespace plot;
+
+static volatile std::sig_atomic_t run = true;
+
+int main() {
+    std::signal(SIGINT, [](int) {
+        run = false;
+    });
+
+    TerminalInfo term;
+    term.detect();
+
+    RealCanvas<BrailleCanvas> canvas({ { -2.0f, 1.5f }, { 2.0f, -1.5f } }, Size(60, 12), term);
+
+    // Axes wraps the canvas (here by pointer) and adds tick labels
+    // to its left and bottom sides. Tick positions and labels are
+    // recomputed only when canvas bounds change.
+    auto ax = axes(&canvas);
+    auto plot = margin(&ax);
+
+    auto bounds = canvas.bounds();
+    auto pixel = canvas.unmap_size({ 1, 1 });
+
+    range_iterator<float> rng(bounds.p1.x, bounds.p2.x + pixel.x, pixel.x);
+    range_iterator<float> rng_end;
+
+    auto wave = [](float t) {
+        return [t](float x) -> Pointf {
+            return { x, (1.0f + 0.8f*std::sin(0.05f*t))*std::sin(3.0f*x - t)*std::exp(-0.25f*x*x) };
+        };
+    };
+
+    // Fit the y axis to the data, with some slack so that bounds
+    // do not change on every frame
+    Autoscale scale;
+    scale.axes(false, true);
+
+    float t = 0.0f;
+
+    while (true) {
+        auto fn = wave(t);
+        scale.apply(canvas, RunningBounds(map(rng, fn), map(rng_end, fn)));
+
+        canvas.clear()
+              .path(palette::royalblue, map(rng, fn), map(rng_end, fn));
+
+        // Axis lines and tick marks are drawn into the canvas
+        ax.draw(term.foreground_color);
+
+        for (auto const& line: plot)
+            std::cout << term.clear_line() << line << '\n';
+
+        std::cout << std::flush;
+
+        if (!run)
+            break;
+
+        using namespace std::chrono_literals;
+        std::this_thread::sleep_for(40ms);
+
+        if (!run)
+            break;
+
+        t += 0.1f;
+
+        std::cout << term.move_up(plot.size().y) << std::flush;
+    }
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "plot.hpp"
+
+#include "iterators.hpp"
+
+#include <cmath>
+#include <csignal>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+using namespace plot;
+
+static volatile std::sig_atomic_t run = true;
+
+int main() {
+    std::signal(SIGINT, [](int) {
+        run = false;
+    });
+
+    TerminalInfo term;
+    term.detect();
+
+    Rectf bounds = { { 0.0f, 1.0f }, { 1.0f, -1.0f } };
+    RealCanvas<BrailleCanvas> sin_canvas(bounds, Size(), term),
+                              cos_canvas(bounds, Size(), term),
+                              sum_canvas(bounds, Size(), term);
+
+    // Two proportional columns; the second row spans a fixed height
+    Grid grid({ Track::fraction(2), Track::fraction(1) },
+              { Track::fraction(), Track::fixed(9) }, 0, 1);
+
+    grid.add(frame(u8"sin(t)", Align::Center, &sin_canvas, term))
+        .add(frame(u8"cos(t)", Align::Center, &cos_canvas, term))
+        .add(frame(u8"sin(t) + cos(t)", Align::Center, &sum_canvas, term))
+        .add(alignment(frame(label(u8"Resize the terminal, Ctrl+C to exit"), term)));
+
+    // Keep the last terminal line free for the cursor
+    SizeWatcher watcher(term);
+    grid.resize(watcher.size() - Size(0, 1));
+
+    Screen screen(grid, term);
+
+    auto plot_fn = [](float (*fn)(float), float t_) {
+        return [fn, t_](float x) -> Pointf {
+            return { x, fn(2*3.141592f*(t_ + 2*x)) };
+        };
+    };
+
+    auto sum = [](float x) {
+        return 0.5f*(std::sin(x) + std::cos(x));
+    };
+
+    std::cout << term.clear();
+
+    float t = 0.0f;
+
+    while (run) {
+        if (watcher.poll([&](Size sz) { grid.resize(sz - Size(0, 1)); }))
+            std::cout << term.clear();
+
+        for (auto canvas: { &sin_canvas, &cos_canvas, &sum_canvas }) {
+            auto pixel = canvas->unmap_size({ 1, 1 });
+            range_iterator<float> rng(bounds.p1.x, bounds.p2.x + pixel.x, pixel.x), rng_end;
+            auto fn = (canvas == &sin_canvas) ? static_cast<float (*)(float)>(std::sin) :
+                      (canvas == &cos_canvas) ? static_cast<float (*)(float)>(std::cos) : +sum;
+
+            canvas->clear()
+                   .path(palette::royalblue, map(rng, plot_fn(fn, t)), map(rng_end, plot_fn(fn, t)));
+        }
+
+        screen.update(std::cout);
+        std::cout << std::flush;
+
+        using namespace std::chrono_literals;
+        std::this_thread::sleep_for(40ms);
+
+        t += 0.01f;
+        if (t >= 1.0f)
+            t -= std::trunc(t);
+    }
+
+    std::cout << term.move_to({ 1, screen.size().y + 1 }) << std::flush;
+
+    return 0;
+}
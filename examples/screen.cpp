@@ -0,0 +1,97 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2016 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "plot.hpp"
+
+#include "iterators.hpp"
+
+#include <cmath>
+#include <csignal>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+using namespace plot;
+
+static volatile std::sig_atomic_t run = true;
+
+int main() {
+    std::signal(SIGINT, [](int) {
+        run = false;
+    });
+
+    TerminalInfo term;
+    term.detect();
+
+    RealCanvas<BrailleCanvas> sin_canvas({ { 0.0f, 1.0f }, { 1.0f, -1.0f } }, Size(30, 7), term);
+    RealCanvas<BrailleCanvas> cos_canvas(sin_canvas.bounds(), sin_canvas.canvas().char_size(), term);
+
+    auto layout = margin(
+        hbox(
+            frame(u8"sin(t)", Align::Center, &sin_canvas, term),
+            vbox(
+                frame(u8"cos(t)", Align::Center, &cos_canvas, term),
+                label(u8"Press Ctrl+C to exit"))));
+
+    // Only lines that changed since the previous frame are written
+    // to the terminal
+    Screen screen(layout, term);
+
+    auto bounds = sin_canvas.bounds();
+    auto pixel = sin_canvas.unmap_size({ 1, 1 });
+
+    range_iterator<float> rng(bounds.p1.x, bounds.p2.x + pixel.x, pixel.x);
+    range_iterator<float> rng_end;
+
+    auto plot_fn = [](float (*fn)(float), float t_) {
+        return [fn, t_](float x) -> Pointf {
+            return { x, fn(2*3.141592f*(t_ + 2*x)) };
+        };
+    };
+
+    std::cout << term.clear();
+
+    float t = 0.0f;
+
+    while (run) {
+        sin_canvas.clear()
+                  .path(palette::royalblue, map(rng, plot_fn(std::sin, t)), map(rng_end, plot_fn(std::sin, t)));
+        cos_canvas.clear()
+                  .path(palette::red, map(rng, plot_fn(std::cos, t)), map(rng_end, plot_fn(std::cos, t)));
+
+        screen.update(std::cout);
+        std::cout << std::flush;
+
+        using namespace std::chrono_literals;
+        std::this_thread::sleep_for(40ms);
+
+        t += 0.01f;
+        if (t >= 1.0f)
+            t -= std::trunc(t);
+    }
+
+    std::cout << term.move_to({ 1, screen.size().y + 1 }) << std::flush;
+
+    return 0;
+}
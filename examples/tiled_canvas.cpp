@@ -0,0 +1,75 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "plot.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <string>
+
+using namespace plot;
+
+// Draw a long history with gaps on a tiled canvas and show a few windows
+// of it. Tiles in the gaps are never allocated.
+int main() {
+    TerminalInfo term;
+    term.detect();
+
+    // 10000 columns, one sample per pixel column
+    Size size(10000, 12);
+    TiledCanvas history(size);
+
+    auto width = history.size().x, height = history.size().y;
+    auto sample = [height](Coord x) {
+        return Coord((0.5f - 0.4f*std::sin(x/40.0f)) * (height - 1));
+    };
+
+    // Samples come in bursts of 600 pixels every 4000
+    for (Coord start = 0; start < width; start += 4000) {
+        Point prev(start, sample(start));
+        for (Coord x = start + 1; x < utils::min(start + 600, width); ++x) {
+            Point next(x, sample(x));
+            history.line(palette::royalblue, prev, next);
+            prev = next;
+        }
+
+        history.text(palette::gold, { start + 2, 0 }, std::to_string(start));
+    }
+
+    auto tiles = size + Size(TiledCanvas::tile_cols - 1, TiledCanvas::tile_lines - 1);
+    std::cout << "tiles allocated: " << history.allocated_tiles() << " of "
+              << (tiles.x/TiledCanvas::tile_cols)*(tiles.y/TiledCanvas::tile_lines) << '\n';
+
+    BrailleCanvas viewport({ 60, size.y }, term);
+    auto layout = margin(frame(&viewport, term));
+
+    for (Coord col: { Coord(0), Coord(250), Coord(4000) }) {
+        history.view(viewport, { col, 0 });
+        std::cout << "\ncolumns " << col << "-" << col + 59 << ":\n";
+        for (auto const& line: layout)
+            std::cout << line << '\n';
+    }
+
+    return 0;
+}
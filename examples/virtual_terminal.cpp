@@ -0,0 +1,112 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "plot.hpp"
+#include "virtual_terminal.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace plot;
+
+// Render a chart into a virtual terminal and compare the resulting cell
+// grid with a golden file:
+//
+//     virtual_terminal [--update] [golden file]
+//
+// With --update, the golden file is (re)written instead.
+// Exit status is 1 on mismatch or when the golden file is missing.
+// The build registers a test against golden/virtual_terminal.txt.
+
+void draw(BrailleCanvas& canvas) {
+    canvas.fill_backgrounds(true)
+          .rect(palette::firebrick, palette::blueviolet, { { 4, 4 }, { 40, 36 } })
+          .ellipse(palette::green, palette::yellow, { 60, 20 }, { 14, 12 })
+          .line(palette::limegreen, { 0, 39 }, { 79, 0 })
+          .text(palette::white, { 2, 0 }, "plot");
+}
+
+int main(int argc, char* argv[]) {
+    Size size(40, 10);
+
+    // Render in 256-color mode: unlike true color, results do not depend
+    // on color rounding. Line feeds after the last line scroll the screen,
+    // so the virtual terminal has an additional empty line.
+    BrailleCanvas canvas(size, TerminalInfo(STDOUT_FILENO, TerminalMode::Ansi256));
+    draw(canvas);
+
+    VirtualTerminal vt(size + Size(0, 1));
+    std::ostream stream(&vt);
+    stream << canvas << std::flush;
+
+    // The same picture rendered as true color takes more bytes
+    BrailleCanvas canvas24(size, TerminalInfo(STDOUT_FILENO, TerminalMode::Iso24bit));
+    draw(canvas24);
+
+    VirtualTerminal vt24(size + Size(0, 1));
+    std::ostream stream24(&vt24);
+    stream24 << canvas24 << std::flush;
+
+    std::cout << canvas
+              << "256 colors: " << vt.bytes() << " bytes, " << vt.escapes() << " escape sequences\n"
+              << "true color: " << vt24.bytes() << " bytes, " << vt24.escapes() << " escape sequences\n"
+              << "cells differing in color: " << vt.difference(vt24) << '\n';
+
+    bool update = argc > 1 && std::string(argv[1]) == "--update";
+    if (argc < 2 + update)
+        return 0;
+
+    char const* path = argv[1 + update];
+
+    if (update) {
+        std::ofstream out(path, std::ios::binary);
+        out << vt.dump();
+        if (!out) {
+            std::cout << "cannot write " << path << '\n';
+            return 1;
+        }
+
+        std::cout << "golden file written to " << path << '\n';
+        return 0;
+    }
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        std::cout << "cannot read " << path << " (run with --update to create it)\n";
+        return 1;
+    }
+
+    std::ostringstream golden;
+    golden << in.rdbuf();
+
+    if (!vt.matches(golden.str())) {
+        std::cout << "output does not match " << path << ":\n" << vt.dump();
+        return 1;
+    }
+
+    std::cout << "output matches " << path << '\n';
+    return 0;
+}
@@ -0,0 +1,314 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "point.hpp"
+#include "real_canvas.hpp"
+#include "rect.hpp"
+#include "utils.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <utility>
+
+namespace plot
+{
+
+// Bounding box of all points added so far
+class RunningBounds {
+public:
+    RunningBounds() = default;
+
+    template<typename Iterator>
+    RunningBounds(Iterator first, Iterator last) {
+        add(first, last);
+    }
+
+    RunningBounds& add(Pointf const& p) {
+        min_.x = utils::min(min_.x, p.x);
+        min_.y = utils::min(min_.y, p.y);
+        max_.x = utils::max(max_.x, p.x);
+        max_.y = utils::max(max_.y, p.y);
+        return *this;
+    }
+
+    template<typename Iterator>
+    RunningBounds& add(Iterator first, Iterator last) {
+        for (; first != last; ++first)
+            add(*first);
+
+        return *this;
+    }
+
+    RunningBounds& clear() {
+        return (*this) = RunningBounds();
+    }
+
+    bool empty() const {
+        return min_.x > max_.x;
+    }
+
+    // Sorted bounding box; empty rectangle at origin if no point was added.
+    // Check empty() first: the origin is not data.
+    Rectf bounds() const {
+        return empty() ? Rectf() : Rectf(min_, max_);
+    }
+
+private:
+    Pointf min_{ std::numeric_limits<Coordf>::infinity(), std::numeric_limits<Coordf>::infinity() };
+    Pointf max_{ -std::numeric_limits<Coordf>::infinity(), -std::numeric_limits<Coordf>::infinity() };
+};
+
+namespace detail
+{
+    // Extremum of the last n values of a sequence. Values that can never
+    // become the extremum are dropped as soon as a better one arrives,
+    // so each value is pushed and popped at most once.
+    template<typename Compare>
+    class window_extremum {
+    public:
+        void push(std::size_t index, Coordf value) {
+            while (!values_.empty() && !Compare()(values_.back().second, value))
+                values_.pop_back();
+
+            values_.emplace_back(index, value);
+        }
+
+        // Drop values with index less than first
+        void expire(std::size_t first) {
+            while (!values_.empty() && values_.front().first < first)
+                values_.pop_front();
+        }
+
+        Coordf value() const {
+            return values_.front().second;
+        }
+
+        void clear() {
+            values_.clear();
+        }
+
+    private:
+        std::deque<std::pair<std::size_t, Coordf>> values_;
+    };
+} /* namespace detail */
+
+// Bounding box of the last window points added,
+// maintained in amortized constant time per point
+class WindowBounds {
+public:
+    explicit WindowBounds(std::size_t window)
+        : window_(utils::max(window, std::size_t(1)))
+        {}
+
+    std::size_t window() const {
+        return window_;
+    }
+
+    WindowBounds& add(Pointf const& p) {
+        min_x_.push(count_, p.x);
+        min_y_.push(count_, p.y);
+        max_x_.push(count_, p.x);
+        max_y_.push(count_, p.y);
+
+        ++count_;
+
+        if (count_ > window_) {
+            auto first = count_ - window_;
+            min_x_.expire(first);
+            min_y_.expire(first);
+            max_x_.expire(first);
+            max_y_.expire(first);
+        }
+
+        return *this;
+    }
+
+    template<typename Iterator>
+    WindowBounds& add(Iterator first, Iterator last) {
+        for (; first != last; ++first)
+            add(*first);
+
+        return *this;
+    }
+
+    WindowBounds& clear() {
+        count_ = 0;
+        min_x_.clear();
+        min_y_.clear();
+        max_x_.clear();
+        max_y_.clear();
+        return *this;
+    }
+
+    bool empty() const {
+        return !count_;
+    }
+
+    // Sorted bounding box; empty rectangle at origin if no point was added
+    Rectf bounds() const {
+        if (empty())
+            return {};
+
+        return {
+            { min_x_.value(), min_y_.value() },
+            { max_x_.value(), max_y_.value() }
+        };
+    }
+
+private:
+    std::size_t window_;
+    std::size_t count_ = 0;
+    detail::window_extremum<std::less<Coordf>> min_x_, min_y_;
+    detail::window_extremum<std::greater<Coordf>> max_x_, max_y_;
+};
+
+// Fit RealCanvas bounds to data bounds. New bounds are padded by margin
+// plus hysteresis (fractions of the data range) on each side, and are kept
+// until data leaves them or shrinks enough that the padding on both sides
+// grows past margin plus three times hysteresis. Slowly drifting data thus
+// does not rescale the canvas on every frame.
+class Autoscale {
+public:
+    explicit Autoscale(float margin = 0.05f, float hysteresis = 0.1f)
+        : margin_(margin), hysteresis_(hysteresis)
+        {}
+
+    float margin() const {
+        return margin_;
+    }
+
+    float hysteresis() const {
+        return hysteresis_;
+    }
+
+    // Enable or disable scaling per axis
+    Autoscale& axes(bool x, bool y) {
+        x_ = x;
+        y_ = y;
+        return *this;
+    }
+
+    // Bounds to use for data, given the current bounds. Axis orientation
+    // of current is preserved (e.g. a flipped y axis stays flipped).
+    Rectf fit(Rectf const& current, Rectf const& data) const {
+        auto result = current;
+        auto sorted = data.sorted();
+
+        if (x_)
+            fit_axis(result.p1.x, result.p2.x, sorted.p1.x, sorted.p2.x);
+
+        if (y_)
+            fit_axis(result.p1.y, result.p2.y, sorted.p1.y, sorted.p2.y);
+
+        return result;
+    }
+
+    // Update canvas bounds; returns true when they changed and the canvas
+    // has to be redrawn from scratch. Bounds are left untouched, and false
+    // is returned, when data or fitted bounds are not finite on an enabled
+    // axis, e.g. for zero or negative values on a logarithmic scale.
+    template<typename Canvas, typename XScale, typename YScale>
+    bool apply(RealCanvas<Canvas, XScale, YScale>& canvas, Rectf const& data) const {
+        // Fit in scaled space, so that padding is uniform on screen
+        auto const& xs = canvas.x_scale();
+        auto const& ys = canvas.y_scale();
+
+        auto forward = [&xs,&ys](Rectf const& r) -> Rectf {
+            return {
+                { xs.forward(r.p1.x), ys.forward(r.p1.y) },
+                { xs.forward(r.p2.x), ys.forward(r.p2.y) }
+            };
+        };
+
+        auto current = forward(canvas.bounds());
+        if (!finite(data))
+            return false;
+
+        auto scaled = forward(data);
+        if (!finite(scaled))
+            return false;
+
+        auto bounds = fit(current, scaled);
+        if (bounds == current)
+            return false;
+
+        Rectf result = {
+            { xs.inverse(bounds.p1.x), ys.inverse(bounds.p1.y) },
+            { xs.inverse(bounds.p2.x), ys.inverse(bounds.p2.y) }
+        };
+
+        if (!finite(result))
+            return false;
+
+        canvas.bounds(result);
+        return true;
+    }
+
+    // Fit to tracked data; returns false when no point was added yet
+    template<typename Canvas, typename XScale, typename YScale>
+    bool apply(RealCanvas<Canvas, XScale, YScale>& canvas, RunningBounds const& data) const {
+        return !data.empty() && apply(canvas, data.bounds());
+    }
+
+    template<typename Canvas, typename XScale, typename YScale>
+    bool apply(RealCanvas<Canvas, XScale, YScale>& canvas, WindowBounds const& data) const {
+        return !data.empty() && apply(canvas, data.bounds());
+    }
+
+private:
+    bool finite(Rectf const& r) const {
+        return (!x_ || (std::isfinite(r.p1.x) && std::isfinite(r.p2.x))) &&
+               (!y_ || (std::isfinite(r.p1.y) && std::isfinite(r.p2.y)));
+    }
+
+    void fit_axis(Coordf& first, Coordf& last, Coordf lo, Coordf hi) const {
+        auto range = hi - lo;
+        if (!(range > 0.0f))
+            range = utils::max(std::abs(lo), 1.0f);
+
+        auto flipped = first > last;
+        auto cur = utils::minmax(first, last);
+
+        auto contained = lo >= cur.first && hi <= cur.second;
+        auto loose = (cur.second - cur.first) > range*(1.0f + 2.0f*(margin_ + 3.0f*hysteresis_));
+
+        if (contained && !loose)
+            return;
+
+        auto pad = range*(margin_ + hysteresis_);
+        first = flipped ? hi + pad : lo - pad;
+        last = flipped ? lo - pad : hi + pad;
+    }
+
+    float margin_;
+    float hysteresis_;
+    bool x_ = true, y_ = true;
+};
+
+} /* namespace plot */
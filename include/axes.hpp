@@ -0,0 +1,345 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "color.hpp"
+#include "layout.hpp"
+#include "point.hpp"
+#include "rect.hpp"
+#include "terminal.hpp"
+#include "utils.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace plot
+{
+
+template<typename Block>
+class Axes;
+
+namespace detail
+{
+    // Step between ticks: 1, 2 or 5 times a power of ten, such that
+    // at most max_ticks steps cover range
+    inline float nice_step(float range, std::size_t max_ticks) {
+        if (!(range > 0.0f) || !max_ticks)
+            return 0.0f;
+
+        auto raw = range / max_ticks;
+        auto mag = std::pow(10.0f, std::floor(std::log10(raw)));
+        auto norm = raw / mag;
+
+        return mag * ((norm <= 1.0f) ? 1.0f :
+                      (norm <= 2.0f) ? 2.0f :
+                      (norm <= 5.0f) ? 5.0f : 10.0f);
+    }
+
+    // Multiples of step in [lo, hi], at most max_count of them
+    inline std::vector<float> nice_ticks(float lo, float hi, float step, std::size_t max_count) {
+        std::vector<float> ticks;
+
+        if (!(step > 0.0f) || !std::isfinite(step) || !std::isfinite(lo) || !std::isfinite(hi))
+            return ticks;
+
+        // Tolerance for values landing right on the bounds
+        auto eps = step*1e-3f;
+        auto first = std::ceil(double(lo - eps)/step),
+             last = std::floor(double(hi + eps)/step);
+
+        if (!(last >= first))
+            return ticks;
+
+        // Count ticks up front: past 2^24, adding 1 to a float
+        // multiplier no longer changes it
+        auto count = std::size_t(utils::min(last - first + 1.0, double(max_count)));
+
+        ticks.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            ticks.push_back(float((first + double(i))*step));
+
+        return ticks;
+    }
+
+    inline std::string tick_label(float value, float step) {
+        int decimals = utils::max(0, -int(std::floor(std::log10(step))));
+
+        // Avoid printing -0
+        if (std::abs(value) < step*1e-3f)
+            value = 0.0f;
+
+        char buf[32];
+        std::snprintf(buf, sizeof(buf), "%.*f", decimals, double(value));
+        return buf;
+    }
+
+    // Tick positions and labels for the current bounds and canvas size
+    struct axes_layout {
+        bool valid = false;
+        Rectf bounds;
+        Size size;
+
+        std::vector<Coord> xticks, yticks;  // Pixels
+        std::vector<std::string> ylabels;   // One per line, empty if none
+        std::string xlabels;                // Line below the canvas
+        std::size_t label_width = 0;
+    };
+
+    template<typename T>
+    inline T& axes_target(T& block) {
+        return block;
+    }
+
+    template<typename T>
+    inline T& axes_target(T* block) {
+        return *block;
+    }
+
+    template<typename Block>
+    class axes_line;
+
+    template<typename Block>
+    std::ostream& operator<<(std::ostream&, axes_line<Block> const&);
+
+    template<typename Block>
+    class axes_line {
+        using block_iterator = typename detail::block_traits<Block>::iterator;
+
+        friend class detail::block_iterator<Axes<Block>, axes_line>;
+        friend class Axes<Block>;
+
+        friend std::ostream& operator<< <Block>(std::ostream&, axes_line const&);
+
+        axes_line(Axes<Block> const* axes, Coord row, block_iterator line, block_iterator end)
+            : axes_(axes), row_(row), line_(std::move(line)), end_(std::move(end))
+            {}
+
+        axes_line next() const {
+            return (line_ == end_) ? axes_line(axes_, row_ + 1, line_, end_)
+                                   : axes_line(axes_, row_ + 1, std::next(line_), end_);
+        }
+
+        bool equal(axes_line const& other) const {
+            return row_ == other.row_;
+        }
+
+        Axes<Block> const* axes_ = nullptr;
+        Coord row_ = 0;
+        block_iterator line_{}, end_{};
+
+    public:
+        axes_line() = default;
+    };
+
+    template<typename Block>
+    inline std::ostream& operator<<(std::ostream& stream, axes_line<Block> const& line) {
+        auto const& layout = line.axes_->layout();
+
+        if (line.line_ == line.end_)
+            return stream << std::string(layout.label_width + 1, ' ') << layout.xlabels;
+
+        auto const& label = layout.ylabels[line.row_];
+        return stream << std::string(layout.label_width - label.size(), ' ')
+                      << label << ' ' << *line.line_;
+    }
+} /* namespace detail */
+
+// Decorate a RealCanvas (or a pointer to one) with tick labels: values
+// on the y axis are written to the left of the canvas, values on the x axis
+// below it. Ticks fall on "nice" values (1, 2 or 5 times a power of ten).
+// Tick layout is recomputed only when bounds or canvas size change.
+// XXX: Ticks are chosen in data space, so on non-linear scales
+// they are not evenly spaced.
+template<typename Block>
+class Axes {
+public:
+    using value_type = detail::axes_line<Block>;
+    using reference = value_type const&;
+    using const_reference = value_type const&;
+    using const_iterator = detail::block_iterator<Axes<Block>, value_type>;
+    using iterator = const_iterator;
+    using difference_type = typename const_iterator::difference_type;
+    using size_type = Size;
+
+    explicit Axes(Block block)
+        : block_(std::move(block))
+        {}
+
+    Size size() const {
+        layout();
+        return layout_size();
+    }
+
+    // Resize the canvas so that the whole block takes the given size
+    Axes& resize(Size sz) {
+        auto const& l = layout();
+        detail::block_traits<Block>::resize(block_, {
+            utils::max(sz.x - Coord(l.label_width) - 1, Coord(0)),
+            utils::max(sz.y - 1, Coord(0))
+        });
+        return *this;
+    }
+
+    // Draw axis lines and tick marks along the left and bottom edges
+    // of the canvas. Call after clearing the canvas.
+    Axes& draw(Color const& color, TerminalOp op = TerminalOp::Over) {
+        auto const& l = layout();
+        auto& canvas = detail::axes_target(block_).canvas();
+        auto sz = canvas.size();
+
+        canvas.push()
+              .line(color, { 0, 0 }, { 0, sz.y - 1 }, TerminalOp::Over)
+              .line(color, { 0, sz.y - 1 }, { sz.x - 1, sz.y - 1 }, TerminalOp::Over);
+
+        for (auto y: l.yticks)
+            canvas.dot(color, { 1, y }, TerminalOp::Over);
+
+        for (auto x: l.xticks)
+            canvas.dot(color, { x, sz.y - 2 }, TerminalOp::Over);
+
+        canvas.pop(op);
+        return *this;
+    }
+
+    detail::axes_layout const& layout() const {
+        auto const& real = detail::axes_target(block_);
+        auto sz = detail::block_traits<Block>::size(block_);
+
+        if (!layout_.valid || layout_.bounds != real.bounds() || layout_.size != sz)
+            compute_layout(real, sz);
+
+        return layout_;
+    }
+
+    const_iterator begin() const {
+        return cbegin();
+    }
+
+    const_iterator end() const {
+        return cend();
+    }
+
+    const_iterator cbegin() const {
+        return { { this, 0, detail::block_traits<Block>::begin(block_), detail::block_traits<Block>::end(block_) } };
+    }
+
+    const_iterator cend() const {
+        return { { this, detail::block_traits<Block>::size(block_).y + 1,
+                   detail::block_traits<Block>::end(block_), detail::block_traits<Block>::end(block_) } };
+    }
+
+private:
+    Size layout_size() const {
+        return layout_.size + Size(Coord(layout_.label_width) + 1, 1);
+    }
+
+    template<typename Real>
+    void compute_layout(Real const& real, Size sz) const {
+        auto valid = layout_.valid;
+        auto previous = layout_size();
+
+        compute_ticks(real, sz);
+
+        // Label width follows the bounds: parent layouts must
+        // drop their cached geometry when it changes the size
+        if (valid && layout_size() != previous)
+            invalidate_layout();
+    }
+
+    template<typename Real>
+    void compute_ticks(Real const& real, Size sz) const {
+        auto bounds = real.bounds();
+        auto sorted = bounds.sorted();
+        auto pixels = real.canvas().size();
+
+        layout_.valid = true;
+        layout_.bounds = bounds;
+        layout_.size = sz;
+        layout_.xticks.clear();
+        layout_.yticks.clear();
+        layout_.ylabels.assign(std::size_t(utils::max(sz.y, Coord(0))), std::string());
+        layout_.xlabels.assign(std::size_t(utils::max(sz.x, Coord(0))), ' ');
+        layout_.label_width = 0;
+
+        if (sz.x <= 0 || sz.y <= 0)
+            return;
+
+        // Y labels: roughly one every other line
+        auto ycount = std::size_t(utils::max(sz.y/2, Coord(1)));
+        auto ystep = detail::nice_step(sorted.p2.y - sorted.p1.y, ycount);
+        for (auto value: detail::nice_ticks(sorted.p1.y, sorted.p2.y, ystep, ycount + 1)) {
+            auto y = utils::clamp(real.map(Pointf(bounds.p1.x, value)).y, Coord(0), pixels.y - 1);
+            layout_.yticks.push_back(y);
+
+            auto& label = layout_.ylabels[std::size_t(y*sz.y/pixels.y)];
+            if (label.empty()) {
+                label = detail::tick_label(value, ystep);
+                layout_.label_width = utils::max(layout_.label_width, label.size());
+            }
+        }
+
+        // X labels: centered on their tick, skipped when they would overlap
+        auto xcount = std::size_t(utils::max(sz.x/10, Coord(1)));
+        auto xstep = detail::nice_step(sorted.p2.x - sorted.p1.x, xcount);
+        Coord free = 0;
+        for (auto value: detail::nice_ticks(sorted.p1.x, sorted.p2.x, xstep, xcount + 1)) {
+            auto x = utils::clamp(real.map(Pointf(value, bounds.p1.y)).x, Coord(0), pixels.x - 1);
+            layout_.xticks.push_back(x);
+
+            auto label = detail::tick_label(value, xstep);
+            auto len = Coord(label.size());
+            auto start = utils::clamp(x*sz.x/pixels.x - len/2, Coord(0), utils::max(sz.x - len, Coord(0)));
+
+            if (start >= free && start + len <= sz.x) {
+                layout_.xlabels.replace(std::size_t(start), label.size(), label);
+                free = start + len + 1;
+            }
+        }
+    }
+
+    Block block_;
+    mutable detail::axes_layout layout_;
+};
+
+template<typename Block>
+inline std::ostream& operator<<(std::ostream& stream, Axes<Block> const& axes) {
+    for (auto const& line: axes)
+        stream << line << '\n';
+
+    return stream;
+}
+
+template<typename Block>
+inline Axes<std::decay_t<Block>> axes(Block&& block) {
+    return Axes<std::decay_t<Block>>(std::forward<Block>(block));
+}
+
+} /* namespace plot */
@@ -25,16 +25,19 @@
 #pragma once
 
 #include "color.hpp"
+#include "font_data.hpp"
 #include "layout.hpp"
 #include "point.hpp"
 #include "rect.hpp"
+#include "stats.hpp"
+#include "string_view.hpp"
 #include "terminal.hpp"
+#include "unicode.hpp"
 #include "utils.hpp"
 
 #include <cmath>
 #include <cstdint>
 #include <algorithm>
-#include <forward_list>
 #include <iterator>
 #include <ostream>
 #include <string>
@@ -43,7 +46,14 @@
 namespace plot
 {
 
-class BrailleCanvas;
+class DensityCanvas;
+
+// Canvases depend on PLOT_ENABLE_STATS, see stats.hpp
+inline namespace PLOT_STATS_NAMESPACE
+{
+    class BrailleCanvas;
+    class TiledCanvas;
+} /* inline namespace PLOT_STATS_NAMESPACE */
 
 namespace detail { namespace braille
 {
@@ -54,16 +64,34 @@ namespace detail { namespace braille
     // See https://en.wikipedia.org/wiki/Braille_Patterns
     static constexpr std::uint8_t pixel_codes[cell_cols][cell_rows] = { { 0x01, 0x02, 0x04, 0x40 }, { 0x08, 0x10, 0x20, 0x80 } };
 
+    // Text is drawn with a 3x5 font in 4x8 pixel boxes (2x2 cells)
+    constexpr std::uint8_t glyph_cols = 4;
+    constexpr std::uint8_t glyph_rows = 8;
+    constexpr std::uint8_t glyph_top = 1;
+
+    // Characters outside printable ASCII are drawn as '?'
+    inline std::size_t glyph_index(char32_t cp) {
+        return (cp >= 0x20 && cp <= 0x7E) ? cp - 0x20 : '?' - 0x20;
+    }
+
+    // Count set bits in parallel: pairs, then nibbles, then the whole byte
+    inline constexpr std::uint8_t bitcount_nibbles(unsigned n) {
+        return std::uint8_t((n + (n >> 4)) & 0x0F);
+    }
+
+    inline constexpr std::uint8_t bitcount_pairs(unsigned n) {
+        return bitcount_nibbles((n & 0x33) + ((n >> 2) & 0x33));
+    }
+
     inline constexpr std::uint8_t bitcount(std::uint8_t n) {
-        return (n & 1) + bool(n & 2) + bool(n & 4) + bool(n & 8) +
-               bool(n & 16) + bool(n & 32) + bool(n & 64) + bool(n & 128);
+        return bitcount_pairs(n - ((n >> 1) & 0x55u));
     }
 
     struct block_t {
         constexpr block_t() = default;
 
-        constexpr block_t(Color c, bool px00, bool px01, bool px02, bool px03,
-                                   bool px10, bool px11, bool px12, bool px13)
+        constexpr block_t(fixed_color c, bool px00, bool px01, bool px02, bool px03,
+                                         bool px10, bool px11, bool px12, bool px13)
             : color(c),
               pixels(pixel_codes[0][0]*px00 | pixel_codes[0][1]*px01 |
                      pixel_codes[0][2]*px02 | pixel_codes[0][3]*px03 |
@@ -71,10 +99,23 @@ namespace detail { namespace braille
                      pixel_codes[1][2]*px12 | pixel_codes[1][3]*px13)
             {}
 
-        constexpr block_t(Color c, std::uint8_t px = 0)
+        block_t(Color c, std::uint8_t px = 0)
+            : color(c), pixels(px)
+            {}
+
+        constexpr block_t(fixed_color c, std::uint8_t px = 0)
             : color(c), pixels(px)
             {}
 
+        constexpr block_t(fixed_color c, std::uint8_t px, fixed_color bg)
+            : color(c), background(bg), pixels(px)
+            {}
+
+        // Cell with no pixels and no background color
+        constexpr bool empty() const {
+            return !pixels && !background.a;
+        }
+
         block_t& clear() {
             pixels = 0;
             return *this;
@@ -90,33 +131,49 @@ namespace detail { namespace braille
             return *this;
         }
 
+        // Cell color is the mean of the colors of its pixels: old ones,
+        // new ones, and new ones painted over old ones.
+        // A background color is painted over the old background and
+        // pixels: opaque ones hide old pixels entirely.
         block_t over(block_t const& other) const {
-            auto old = bitcount(other.pixels & ~pixels);
-            auto new_ = bitcount(pixels & ~other.pixels);
+            auto dst = other;
 
-            std::uint8_t over_pixels = other.pixels & pixels;
-            auto over_ = bitcount(over_pixels);
+            if (background.a) {
+                dst.background = background.over(other.background);
 
-            float total = old + new_ + over_;
+                if (background.a == 0xFFFF)
+                    dst.pixels = 0;
+                else
+                    dst.color = background.over(other.color);
+            }
 
-            auto old_color = (other.color.a != 0.0f) ? other.color : color;
-            auto new_color = (color.a != 0.0f) ? color : other.color;
-            auto over_color = new_color.over(old_color);
+            auto old = bitcount(dst.pixels & ~pixels);
+            auto new_ = bitcount(pixels & ~dst.pixels);
+            auto over_ = bitcount(dst.pixels & pixels);
 
-            auto mixed_color = (old/total)*old_color + (new_/total)*new_color + (over_/total)*over_color;
+            if (!(old + new_ + over_))
+                return { color, pixels, dst.background };
 
-            return { mixed_color, std::uint8_t(pixels | other.pixels) };
+            auto old_color = dst.color.a ? dst.color : color;
+            auto new_color = color.a ? color : dst.color;
+            auto over_color = new_color.over(old_color);
+
+            return {
+                mix(old_color, old, new_color, new_, over_color, over_),
+                std::uint8_t(pixels | dst.pixels),
+                dst.background
+            };
         }
 
         block_t paint(block_t const& dst, TerminalOp op) const {
-            if (pixels) {
+            if (!empty()) {
                 switch (op) {
                     case TerminalOp::Over:
                         return over(dst);
                     case TerminalOp::ClipDst:
                         return *this;
                     case TerminalOp::ClipSrc:
-                        if (!dst.pixels)
+                        if (dst.empty())
                             return *this;
                 }
             }
@@ -125,11 +182,11 @@ namespace detail { namespace braille
         }
 
         constexpr block_t operator~() const {
-            return { color, std::uint8_t(~pixels) };
+            return { color, std::uint8_t(~pixels), background };
         }
 
         constexpr block_t operator|(block_t const& other) const {
-            return { color, std::uint8_t(pixels | other.pixels) };
+            return { color, std::uint8_t(pixels | other.pixels), background };
         }
 
         block_t& operator|=(block_t const& other) {
@@ -137,63 +194,209 @@ namespace detail { namespace braille
         }
 
         constexpr block_t operator&(block_t const& other) const {
-            return { color, std::uint8_t(pixels & other.pixels) };
+            return { color, std::uint8_t(pixels & other.pixels), background };
         }
 
         block_t& operator&=(block_t const& other) {
             return (*this) = (*this) & other;
         }
 
-        Color color{ 0, 0, 0, 0 };
+        fixed_color color;
+        fixed_color background;  // Transparent: canvas background shows through
         std::uint8_t pixels = 0;
     };
 
-    class image_t : public std::vector<block_t>
+    // Stack of layers with the same layout, carved from a single buffer.
+    // The top layer is the current image. Layers above it are kept as
+    // a pool: push() and pop() only move the top index, and the buffer
+    // grows only when the stack gets deeper than ever before.
+    class layer_stack
     {
-        using base = std::vector<block_t>;
-
     public:
-        using base::base;
+        using iterator = std::vector<block_t>::iterator;
+        using const_iterator = std::vector<block_t>::const_iterator;
 
-        image_t(Size sz)
-            : base(sz.y*sz.x)
+        layer_stack() = default;
+
+        layer_stack(Size sz)
+            : size_(sz), cells_(std::size_t(sz.y*sz.x)), blocks_(cells_)
             {}
 
-        void clear() {
-            assign(size(), block_t());
+        // Number of cells in each layer
+        std::size_t cells() const {
+            return cells_;
+        }
+
+        // Number of layers below the top one
+        std::size_t depth() const {
+            return top_;
         }
 
-        void resize(Size from, Size to) {
-            if (std::size_t(to.y*to.x) > size())
-                resize(to.y*to.x, block_t());
+        iterator begin() {
+            return blocks_.begin() + std::ptrdiff_t(offset_);
+        }
 
-            auto first = begin();
+        iterator end() {
+            return begin() + std::ptrdiff_t(cells_);
+        }
 
-            if (to.x < from.x) {
-                for (Coord line = 1, end_ = std::min(to.y, from.y); line < end_; ++line)
-                    std::copy(first + line*from.x, first + line*from.x + to.x, first + line*to.x);
-            } else if (to.x > from.x) {
-                for (Coord line = std::min(to.y, from.y) - 1; line > 0; --line) {
-                    std::copy_backward(first + line*from.x, first + line*from.x + from.x, first + line*to.x + from.x);
-                    std::fill(first + line*from.x, first + line*to.x, block_t());
-                }
-            }
+        const_iterator begin() const {
+            return blocks_.cbegin() + std::ptrdiff_t(offset_);
+        }
+
+        const_iterator end() const {
+            return begin() + std::ptrdiff_t(cells_);
+        }
+
+        block_t& operator[](std::size_t index) {
+            return blocks_[offset_ + index];
+        }
+
+        block_t const& operator[](std::size_t index) const {
+            return blocks_[offset_ + index];
+        }
 
-            if (std::size_t(to.y*to.x) < size())
-                resize(to.y*to.x);
+        // Clear the top layer
+        void clear() {
+            std::fill(begin(), end(), block_t());
+        }
+
+        // Push an empty layer
+        void push() {
+            ++top_;
+            offset_ += cells_;
+
+            if (blocks_.size() < (top_ + 1)*cells_)
+                blocks_.resize((top_ + 1)*cells_);
+            else if (dirty(top_))
+                clear();
         }
 
-        // XXX: undefined behavior if this and other do not have the same layout
-        void paint(image_t const& other, TerminalOp op) {
-            auto dst = begin();
-            for (auto src = other.begin(), src_end = other.end(); src != src_end; ++src, ++dst)
+        // Paint the top layer onto the one below and pop it
+        void pop(TerminalOp op) {
+            if (!top_)
+                return;
+
+            auto src = begin();
+            --top_;
+            offset_ -= cells_;
+
+            for (auto dst = begin(), dst_end = end(); dst != dst_end; ++src, ++dst)
                 *dst = src->paint(*dst, op);
+
+            // The popped layer keeps its content
+            mark_dirty(top_ + 1);
+        }
+
+        // Empty layer above the top one, allocated or cleared only when
+        // needed: scratch storage for shapes. Cells written to it must be
+        // reset to empty before any other call to the stack.
+        block_t* scratch() {
+            auto slot = top_ + 1;
+
+            if (blocks_.size() < (slot + 1)*cells_) {
+                blocks_.resize((slot + 1)*cells_);
+            } else if (dirty(slot)) {
+                std::fill_n(blocks_.data() + slot*cells_, cells_, block_t());
+                dirty_[slot] = false;
+            }
+
+            return blocks_.data() + slot*cells_;
         }
 
+        // Change layout of all layers, preserving their content.
+        // Pooled layers are kept, but their content is not preserved.
+        void resize(Size to);
+
     private:
-        using base::resize;
+        // Change layout in place. Cells must all move in the same
+        // direction: columns and cells per layer must not change
+        // in opposite directions.
+        void relayout(Size to);
+
+        // Start of row y of layer k, with the given layout
+        iterator row(std::size_t k, Coord y, Size layout) {
+            return blocks_.begin() + std::ptrdiff_t(k*std::size_t(layout.y*layout.x) + std::size_t(y*layout.x));
+        }
+
+        // Whether a layer above the top one may hold content
+        bool dirty(std::size_t slot) const {
+            return slot < dirty_.size() && dirty_[slot];
+        }
+
+        void mark_dirty(std::size_t slot) {
+            if (dirty_.size() <= slot)
+                dirty_.resize(slot + 1, false);
+            dirty_[slot] = true;
+        }
+
+        Size size_;
+        std::size_t cells_ = 0, top_ = 0;
+        std::size_t offset_ = 0;    // top_*cells_
+        std::vector<block_t> blocks_;
+        std::vector<bool> dirty_;   // Per layer; layers past the end are clean
     };
 
+    inline void layer_stack::resize(Size to) {
+        auto cells = std::size_t(to.y*to.x);
+
+        // When columns and cells per layer change in opposite directions,
+        // some cells move forward and some backward: change columns
+        // and rows in separate passes
+        if (to.x < size_.x && cells > cells_)
+            relayout({ to.x, size_.y });
+        else if (to.x > size_.x && cells < cells_)
+            relayout({ size_.x, to.y });
+
+        relayout(to);
+    }
+
+    inline void layer_stack::relayout(Size to) {
+        auto from = size_;
+        auto from_cells = cells_;
+        auto slots = utils::max(blocks_.size()/utils::max(from_cells, std::size_t(1)), top_ + 1);
+
+        // Pooled layers are not relaid out
+        dirty_.assign(slots, true);
+
+        size_ = to;
+        cells_ = std::size_t(to.y*to.x);
+        offset_ = top_*cells_;
+
+        auto rows = utils::min(from.y, to.y), cols = utils::min(from.x, to.x);
+
+        if (cells_ <= from_cells && to.x <= from.x) {
+            // Rows move towards the start of the buffer: walk forward
+            for (std::size_t k = 0; k <= top_; ++k) {
+                for (Coord y = 0; y < rows; ++y) {
+                    auto src = row(k, y, from), dst = row(k, y, to);
+                    if (src != dst)
+                        std::copy(src, src + cols, dst);
+                }
+
+                std::fill(row(k, rows, to), row(k + 1, 0, to), block_t());
+            }
+
+            blocks_.resize(slots*cells_);
+        } else {
+            // Rows move towards the end of the buffer: walk backward
+            blocks_.resize(slots*cells_);
+
+            for (std::size_t k = top_ + 1; k-- > 0;) {
+                std::fill(row(k, rows, to), row(k + 1, 0, to), block_t());
+
+                for (Coord y = rows; y-- > 0;) {
+                    auto src = row(k, y, from), dst = row(k, y, to);
+                    if (src != dst)
+                        std::copy_backward(src, src + cols, dst + cols);
+                    std::fill(dst + cols, dst + to.x, block_t());
+                }
+            }
+        }
+    }
+
+inline namespace PLOT_STATS_NAMESPACE
+{
     class line_t;
 
     template<typename = void>
@@ -206,7 +409,7 @@ namespace detail { namespace braille
         template<typename>
         friend std::ostream& operator<<(std::ostream&, line_t const&);
 
-        line_t(BrailleCanvas const* canvas, image_t::const_iterator it)
+        line_t(BrailleCanvas const* canvas, layer_stack::const_iterator it)
             : canvas_(canvas), it_(it)
             {}
 
@@ -217,14 +420,17 @@ namespace detail { namespace braille
         }
 
         BrailleCanvas const* canvas_ = nullptr;
-        image_t::const_iterator it_{};
+        layer_stack::const_iterator it_{};
 
     public:
         line_t() = default;
     };
+} /* inline namespace PLOT_STATS_NAMESPACE */
 } /* namespace braille */ } /* namespace detail */
 
 
+inline namespace PLOT_STATS_NAMESPACE {
+
 class BrailleCanvas {
 public:
     constexpr static uint8_t cell_cols = detail::braille::cell_cols;
@@ -246,16 +452,12 @@ public:
     BrailleCanvas(Size char_sz, TerminalInfo term = TerminalInfo())
         : lines_(char_sz.y), cols_(char_sz.x), blocks_(char_sz),
           background_(term.background_color), term_(term)
-    {
-        available_layers_.emplace_front(char_sz);
-    }
+        {}
 
     BrailleCanvas(Color background, Size char_sz, TerminalInfo term = TerminalInfo())
         : lines_(char_sz.y), cols_(char_sz.x), blocks_(char_sz),
           background_(background), term_(term)
-    {
-        available_layers_.emplace_front(char_sz);
-    }
+        {}
 
     Size char_size() const {
         return { Coord(cols_), Coord(lines_) };
@@ -274,45 +476,48 @@ public:
     }
 
     const_iterator cbegin() const {
-        return { { this, blocks_.cbegin() } };
+        return { { this, blocks_.begin() } };
     }
 
     const_iterator cend() const {
-        return { { this, blocks_.cend() } };
+        return { { this, blocks_.end() } };
+    }
+
+    // Render statistics, collected when PLOT_ENABLE_STATS is defined
+    //
+    // XXX: Rendering updates statistics: rendering a canvas from several
+    // XXX: threads at once is not thread-safe when they are enabled.
+    RenderStats const& stats() const {
+        return stats_;
+    }
+
+    BrailleCanvas& clear_stats() {
+        stats_.clear();
+        return *this;
     }
 
     BrailleCanvas& push() {
-        if (available_layers_.empty())
-            available_layers_.emplace_front(char_size());
+        detail::stats_add(stats_.layers_pushed);
 
-        stack_.splice_after(stack_.before_begin(), available_layers_, available_layers_.before_begin());
-        blocks_.swap(stack_.front());
-        blocks_.clear();
+        blocks_.push();
         return *this;
     }
 
     BrailleCanvas& pop(TerminalOp op = TerminalOp::Over) {
-        if (!stack_.empty()) {
-            stack_.front().paint(blocks_, op);
-            blocks_.swap(stack_.front());
-            available_layers_.splice_after(available_layers_.before_begin(), stack_, stack_.before_begin());
+        if (blocks_.depth()) {
+            detail::stats_timer timer(stats_.compose_time);
+            detail::stats_add(stats_.layers_popped);
+
+            blocks_.pop(op);
         }
         return *this;
     }
 
     BrailleCanvas& resize(Size sz) {
         if (sz != char_size()) {
-            blocks_.resize(char_size(), sz);
-
-            for (auto& layer: stack_)
-                layer.resize(char_size(), sz);
-
-            if (!available_layers_.empty()) {
-                available_layers_.clear();
-                available_layers_.emplace_front(sz);
-            }
-
+            blocks_.resize(sz);
             lines_ = sz.y; cols_ = sz.x;
+            invalidate_layout();
         }
         return *this;
     }
@@ -329,19 +534,20 @@ public:
 
     BrailleCanvas& clear(Rect rct) {
         rct = rct.sorted();
+        rct.p2 += Point(1, 1);
+        rct = rct.clamp(size());
+
+        // Cells overlapping the rectangle
         Rect block_rect{
             { rct.p1.x/cell_cols, rct.p1.y/cell_rows },
-            { utils::max(1l, rct.p2.x/cell_cols + (rct.p2.x%cell_cols)),
-              utils::max(1l, rct.p2.y/cell_rows + (rct.p2.y%cell_rows != 0)) }
+            { (rct.p2.x + cell_cols - 1)/cell_cols, (rct.p2.y + cell_rows - 1)/cell_rows }
         };
 
-        rct.p2 += Point(1, 1);
-
         for (auto ln = block_rect.p1.y; ln < block_rect.p2.y; ++ln) {
             auto ybase = cell_rows*ln;
             for (auto col = block_rect.p1.x; col < block_rect.p2.x; ++col) {
                 auto xbase = cell_cols*col;
-                detail::braille::block_t src({ 0, 0, 0, 0 },
+                detail::braille::block_t src(detail::fixed_color(),
                     rct.contains({ xbase, ybase }),
                     rct.contains({ xbase, ybase+1 }),
                     rct.contains({ xbase, ybase+2 }),
@@ -350,7 +556,13 @@ public:
                     rct.contains({ xbase+1, ybase+1 }),
                     rct.contains({ xbase+1, ybase+2 }),
                     rct.contains({ xbase+1, ybase+3 }));
-                block(ln, col) &= ~src;
+
+                auto& dst = block(ln, col);
+                dst &= ~src;
+
+                // Cells cleared entirely lose their background as well
+                if (src.pixels == 0xFF)
+                    dst.background = detail::fixed_color();
             }
         }
 
@@ -363,6 +575,18 @@ public:
     template<typename Fn>
     BrailleCanvas& fill(Color const& color, Rect rct, Fn&& fn, TerminalOp op = TerminalOp::Over);
 
+    // When enabled, fill() sets the background color of the cells it
+    // covers entirely instead of lighting all of their dots: strokes
+    // drawn later over filled areas remain visible. Disabled by default.
+    BrailleCanvas& fill_backgrounds(bool enable) {
+        fill_backgrounds_ = enable;
+        return *this;
+    }
+
+    bool fill_backgrounds() const {
+        return fill_backgrounds_;
+    }
+
     BrailleCanvas& dot(Color const& color, Point p, TerminalOp op = TerminalOp::Over) {
         if (Rect({}, size()).contains(p)) {
             paint(p.y / cell_rows, p.x / cell_cols, detail::braille::block_t(color).set(p.x % cell_cols, p.y % cell_rows), op);
@@ -370,6 +594,16 @@ public:
         return *this;
     }
 
+    // Set one pixel per point. Points are first collected per cell, then
+    // each touched cell is painted once: overlapping points do not
+    // compound color, and points outside the canvas are skipped.
+    template<typename Iterator>
+    BrailleCanvas& scatter(Color const& color, Iterator first, Iterator last, TerminalOp op = TerminalOp::Over);
+
+    BrailleCanvas& scatter(Color const& color, std::initializer_list<Point> const& points, TerminalOp op = TerminalOp::Over) {
+        return scatter(color, points.begin(), points.end(), op);
+    }
+
     BrailleCanvas& line(Color const& color, Point from, Point to, TerminalOp op = TerminalOp::Over) {
         auto sorted = Rect(from, to).sorted_x();
         auto dx = (sorted.p2.x - sorted.p1.x) + 1,
@@ -389,14 +623,14 @@ public:
 
     template<typename Iterator>
     BrailleCanvas& path(Color const& color, Iterator first, Iterator last, TerminalOp op = TerminalOp::Over) {
-        push();
+        begin_shape();
         auto start = *first;
         while (++first != last) {
             auto end_ = *first;
             line(color, start, end_, TerminalOp::Over);
             start = end_;
         }
-        return pop(op);
+        return end_shape(op);
     }
 
     BrailleCanvas& path(Color const& color, std::initializer_list<Point> const& points, TerminalOp op = TerminalOp::Over) {
@@ -404,17 +638,17 @@ public:
     }
 
     BrailleCanvas& rect(Color const& color, Rect const& rct, TerminalOp op = TerminalOp::Over) {
-        return push()
+        return begin_shape()
               .line(color, rct.p1, { rct.p2.x, rct.p1.y }, TerminalOp::Over)
               .line(color, rct.p1, { rct.p1.x, rct.p2.y }, TerminalOp::Over)
               .line(color, rct.p2, { rct.p2.x, rct.p1.y }, TerminalOp::Over)
               .line(color, rct.p2, { rct.p1.x, rct.p2.y }, TerminalOp::Over)
-              .pop(op);
+              .end_shape(op);
     }
 
     BrailleCanvas& rect(Color const& stroke_color, Color const& fill_color, Rect rct, TerminalOp op = TerminalOp::Over) {
         rct = rct.sorted();
-        return push()
+        return begin_shape()
               .line(stroke_color, rct.p1, { rct.p2.x, rct.p1.y }, TerminalOp::Over)
               .line(stroke_color, rct.p1, { rct.p1.x, rct.p2.y }, TerminalOp::Over)
               .line(stroke_color, rct.p2, { rct.p2.x, rct.p1.y }, TerminalOp::Over)
@@ -422,7 +656,7 @@ public:
               .fill(fill_color, rct, [r=Rect(rct.p1 + Point(1, 1), rct.p2)](Point p) {
                   return r.contains(p);
               }, TerminalOp::Over)
-              .pop(op);
+              .end_shape(op);
     }
 
     BrailleCanvas& ellipse(Color const& color, Rect rct, TerminalOp op = TerminalOp::Over) {
@@ -434,36 +668,36 @@ public:
               cx = rct.p1.x + (size_.x/cell_cols) - (!(size_.x % cell_cols)),
               cy = rct.p1.y + y_fac;
 
-        return push()
+        return begin_shape()
               .stroke(color, { rct.p1, { cx, cy } }, [x_fac,y_fac,cy,x0=rct.p1.x](Coord x) {
                   auto x_over_a = ((x - x0) * x_fac) - 1.0f,
                        next_x_over_a = ((1 + x - x0) * x_fac) - 1.0f;
-                  Coord base = cy - std::lround(y_fac*std::sqrt(1 - x_over_a*x_over_a)),
-                        end_ = cy - std::lround(y_fac*std::sqrt(1 - next_x_over_a*next_x_over_a));
+                  Coord base = cy - std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - x_over_a*x_over_a))),
+                        end_ = cy - std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - next_x_over_a*next_x_over_a)));
                   return (base != end_) ? std::make_pair(base, end_) : std::make_pair(base, base+1);
               }, TerminalOp::Over)
               .stroke(color, { { cx + 1, rct.p1.y }, { rct.p2.x, cy } }, [x_fac,y_fac,cy,x1=rct.p2.x](Coord x) {
                   auto x_over_a = ((x1 - x) * x_fac) - 1.0f,
                        next_x_over_a = ((x1 - x + 1) * x_fac) - 1.0f;
-                  Coord base = cy - std::lround(y_fac*std::sqrt(1 - x_over_a*x_over_a)),
-                        end_ = cy - std::lround(y_fac*std::sqrt(1 - next_x_over_a*next_x_over_a));
+                  Coord base = cy - std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - x_over_a*x_over_a))),
+                        end_ = cy - std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - next_x_over_a*next_x_over_a)));
                   return (base != end_) ? std::make_pair(base, end_) : std::make_pair(base, base+1);
               }, TerminalOp::Over)
               .stroke(color, { { rct.p1.x, cy + 1 }, { cx, rct.p2.y } }, [x_fac,y_fac,cy,x0=rct.p1.x](Coord x) {
                   auto x_over_a = ((x - x0) * x_fac) - 1.0f,
                        next_x_over_a = ((1 + x - x0) * x_fac) - 1.0f;
-                  Coord base = cy + std::lround(y_fac*std::sqrt(1 - x_over_a*x_over_a)),
-                        end_ = cy + std::lround(y_fac*std::sqrt(1 - next_x_over_a*next_x_over_a));
+                  Coord base = cy + std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - x_over_a*x_over_a))),
+                        end_ = cy + std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - next_x_over_a*next_x_over_a)));
                   return (base != end_) ? std::make_pair(base, end_) : std::make_pair(base, base+1);
               }, TerminalOp::Over)
               .stroke(color, { { cx + 1, cy + 1 }, rct.p2 }, [x_fac,y_fac,cy,x1=rct.p2.x](Coord x) {
                   auto x_over_a = ((x1 - x) * x_fac) - 1.0f,
                        next_x_over_a = ((1 + x1 - x) * x_fac) - 1.0f;
-                  Coord base = cy + std::lround(y_fac*std::sqrt(1 - x_over_a*x_over_a)),
-                        end_ = cy + std::lround(y_fac*std::sqrt(1 - next_x_over_a*next_x_over_a));
+                  Coord base = cy + std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - x_over_a*x_over_a))),
+                        end_ = cy + std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - next_x_over_a*next_x_over_a)));
                   return (base != end_) ? std::make_pair(base, end_) : std::make_pair(base, base+1);
               }, TerminalOp::Over)
-              .pop(op);
+              .end_shape(op);
     }
 
     BrailleCanvas& ellipse(Color const& stroke_color, Color const& fill_color, Rect rct, TerminalOp op = TerminalOp::Over) {
@@ -475,56 +709,77 @@ public:
               cx = rct.p1.x + (size_.x/cell_cols) - (!(size_.x % cell_cols)),
               cy = rct.p1.y + y_fac;
 
-        return push()
+        return begin_shape()
               .stroke(stroke_color, { rct.p1, { cx, cy } }, [x_fac,y_fac,cy,x0=rct.p1.x](Coord x) {
                   auto x_over_a = ((x - x0) * x_fac) - 1.0f,
                        next_x_over_a = ((1 + x - x0) * x_fac) - 1.0f;
-                  Coord base = cy - std::lround(y_fac*std::sqrt(1 - x_over_a*x_over_a)),
-                        end_ = cy - std::lround(y_fac*std::sqrt(1 - next_x_over_a*next_x_over_a));
+                  Coord base = cy - std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - x_over_a*x_over_a))),
+                        end_ = cy - std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - next_x_over_a*next_x_over_a)));
                   return (base != end_) ? std::make_pair(base, end_) : std::make_pair(base, base+1);
               }, TerminalOp::Over)
               .stroke(stroke_color, { { cx + 1, rct.p1.y }, { rct.p2.x, cy } }, [x_fac,y_fac,cy,x1=rct.p2.x](Coord x) {
                   auto x_over_a = ((x1 - x) * x_fac) - 1.0f,
                        next_x_over_a = ((x1 - x + 1) * x_fac) - 1.0f;
-                  Coord base = cy - std::lround(y_fac*std::sqrt(1 - x_over_a*x_over_a)),
-                        end_ = cy - std::lround(y_fac*std::sqrt(1 - next_x_over_a*next_x_over_a));
+                  Coord base = cy - std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - x_over_a*x_over_a))),
+                        end_ = cy - std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - next_x_over_a*next_x_over_a)));
                   return (base != end_) ? std::make_pair(base, end_) : std::make_pair(base, base+1);
               }, TerminalOp::Over)
               .stroke(stroke_color, { { rct.p1.x, cy + 1 }, { cx, rct.p2.y } }, [x_fac,y_fac,cy,x0=rct.p1.x](Coord x) {
                   auto x_over_a = ((x - x0) * x_fac) - 1.0f,
                        next_x_over_a = ((1 + x - x0) * x_fac) - 1.0f;
-                  Coord base = cy + std::lround(y_fac*std::sqrt(1 - x_over_a*x_over_a)),
-                        end_ = cy + std::lround(y_fac*std::sqrt(1 - next_x_over_a*next_x_over_a));
+                  Coord base = cy + std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - x_over_a*x_over_a))),
+                        end_ = cy + std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - next_x_over_a*next_x_over_a)));
                   return (base != end_) ? std::make_pair(base, end_) : std::make_pair(base, base+1);
               }, TerminalOp::Over)
               .stroke(stroke_color, { { cx + 1, cy + 1 }, rct.p2 }, [x_fac,y_fac,cy,x1=rct.p2.x](Coord x) {
                   auto x_over_a = ((x1 - x) * x_fac) - 1.0f,
                        next_x_over_a = ((1 + x1 - x) * x_fac) - 1.0f;
-                  Coord base = cy + std::lround(y_fac*std::sqrt(1 - x_over_a*x_over_a)),
-                        end_ = cy + std::lround(y_fac*std::sqrt(1 - next_x_over_a*next_x_over_a));
+                  Coord base = cy + std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - x_over_a*x_over_a))),
+                        end_ = cy + std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - next_x_over_a*next_x_over_a)));
                   return (base != end_) ? std::make_pair(base, end_) : std::make_pair(base, base+1);
               }, TerminalOp::Over)
               .fill(fill_color, { rct.p1, { cx, cy } }, [x_fac,y_fac,cy,x0=rct.p1.x](Point p) {
                   auto x_over_a = ((p.x - x0) * x_fac) - 1.0f;
-                  Coord base = cy - std::lround(y_fac*std::sqrt(1 - x_over_a*x_over_a));
+                  Coord base = cy - std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - x_over_a*x_over_a)));
                   return p.y > base;
               }, TerminalOp::Over)
               .fill(fill_color, { { cx + 1, rct.p1.y }, { rct.p2.x, cy } }, [x_fac,y_fac,cy,x1=rct.p2.x](Point p) {
                   auto x_over_a = ((x1 - p.x) * x_fac) - 1.0f;
-                  Coord base = cy - std::lround(y_fac*std::sqrt(1 - x_over_a*x_over_a));
+                  Coord base = cy - std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - x_over_a*x_over_a)));
                   return p.y > base;
               }, TerminalOp::Over)
               .fill(fill_color, { { rct.p1.x, cy + 1 }, { cx, rct.p2.y } }, [x_fac,y_fac,cy,x0=rct.p1.x](Point p) {
                   auto x_over_a = ((p.x - x0) * x_fac) - 1.0f;
-                  Coord base = cy + std::lround(y_fac*std::sqrt(1 - x_over_a*x_over_a));
+                  Coord base = cy + std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - x_over_a*x_over_a)));
                   return p.y < base;
               }, TerminalOp::Over)
               .fill(fill_color, { { cx + 1, cy + 1 }, rct.p2 }, [x_fac,y_fac,cy,x1=rct.p2.x](Point p) {
                   auto x_over_a = ((x1 - p.x) * x_fac) - 1.0f;
-                  Coord base = cy + std::lround(y_fac*std::sqrt(1 - x_over_a*x_over_a));
+                  Coord base = cy + std::lround(y_fac*std::sqrt(utils::max(0.0f, 1 - x_over_a*x_over_a)));
                   return p.y < base;
               }, TerminalOp::Over)
-              .pop(op);
+              .end_shape(op);
+    }
+
+    // Draw text with the embedded font. Each character takes 4x8 pixels
+    // (2x2 cells), p is the top-left corner of the first one. Line feeds
+    // start a new line of text.
+    BrailleCanvas& text(Color const& color, Point p, string_view str, TerminalOp op = TerminalOp::Over);
+
+    // Size in pixels of text drawn by text()
+    static Size text_size(string_view str) {
+        Coord lines = 1, cols = 0, max_cols = 0;
+
+        for (auto it = str.begin(), end = str.end(); it != end; it = detail::utf8_next(it, end)) {
+            if (*it == '\n') {
+                ++lines;
+                cols = 0;
+            } else {
+                max_cols = utils::max(max_cols, ++cols);
+            }
+        }
+
+        return { detail::braille::glyph_cols*max_cols, detail::braille::glyph_rows*lines };
     }
 
     BrailleCanvas& ellipse(Color const& stroke_color, Point const& center, Size const& semiaxes, TerminalOp op = TerminalOp::Over) {
@@ -537,8 +792,10 @@ public:
 
 private:
     friend value_type;
+    friend class plot::DensityCanvas;
+    friend class TiledCanvas;
     template<typename>
-    friend std::ostream& detail::braille::operator<<(std::ostream&, detail::braille::line_t const&);
+    friend std::ostream& detail::braille::PLOT_STATS_NAMESPACE::operator<<(std::ostream&, detail::braille::line_t const&);
 
     detail::braille::block_t& block(std::size_t ln, std::size_t col) {
         return blocks_[cols_*ln + col];
@@ -550,22 +807,88 @@ private:
 
     detail::braille::block_t& paint(std::size_t ln, std::size_t col,
                                     detail::braille::block_t const& src, TerminalOp op) {
-        auto& dst = block(ln, col);
+        detail::stats_add(stats_.cells_painted);
+
+        auto index = cols_*ln + col;
+
+        if (shape_depth_) {
+            auto& dst = shape_blocks_[index];
+            bool was_empty = dst.empty();
+
+            dst = src.paint(dst, op);
+            if (was_empty && !dst.empty())
+                shape_cells_.push_back(index);
+
+            return dst;
+        }
+
+        auto& dst = blocks_[index];
         return dst = src.paint(dst, op);
     }
 
+    // Shapes made of several drawing operations (paths, rectangles and
+    // ellipses) are composited as a whole, as if drawn on their own layer.
+    // Rather than pushing a layer, which costs a pass over the whole
+    // image on both push and pop, their cells are painted into a scratch
+    // image and the cells they touch are then composited one by one.
+    // Shapes may nest: only the outermost one is composited.
+    //
+    // The scratch image is the free layer above the top one in the layer
+    // stack. Canvases using layers reuse pooled memory; others keep one
+    // extra layer after their first shape. A layer popped since the last
+    // shape is cleared before reuse, which costs one pass over the image.
+    BrailleCanvas& begin_shape() {
+        if (!shape_depth_++)
+            shape_blocks_ = blocks_.scratch();
+        return *this;
+    }
+
+    BrailleCanvas& end_shape(TerminalOp op) {
+        if (--shape_depth_)
+            return *this;
+
+        detail::stats_timer timer(stats_.compose_time);
+
+        for (auto index: shape_cells_) {
+            auto& src = shape_blocks_[index];
+            auto& dst = blocks_[index];
+            dst = src.paint(dst, op);
+            src = detail::braille::block_t();
+        }
+
+        shape_cells_.clear();
+        return *this;
+    }
+
+    void glyph(Color const& color, Point p, std::size_t index, TerminalOp op);
+
     std::size_t lines_ = 0, cols_ = 0;
-    detail::braille::image_t blocks_;
+    detail::braille::layer_stack blocks_;
+
+    // Scratch storage for scatter(): pixel masks per cell,
+    // all zero between calls
+    std::vector<std::uint8_t> scatter_masks_;
 
-    std::forward_list<detail::braille::image_t> stack_;
-    std::forward_list<detail::braille::image_t> available_layers_;
+    // Scratch storage for shapes: cells painted since the outermost
+    // begin_shape() call, and their indices. Valid inside shapes only.
+    detail::braille::block_t* shape_blocks_ = nullptr;
+    std::vector<std::size_t> shape_cells_;
+    unsigned shape_depth_ = 0;
 
     Color background_ = { 0, 0, 0, 1 };
+    bool fill_backgrounds_ = false;
     TerminalInfo term_;
+
+    // Updated by rendering too
+    mutable RenderStats stats_;
 };
 
+} /* inline namespace PLOT_STATS_NAMESPACE */
+
 template<typename Fn>
 BrailleCanvas& BrailleCanvas::stroke(Color const& color, Rect rct, Fn&& fn, TerminalOp op) {
+    detail::stats_timer timer(stats_.draw_time);
+
     rct = rct.sorted();
     rct.p2 += Point(1, 1);
     rct = rct.clamp(size());
@@ -575,6 +898,8 @@ BrailleCanvas& BrailleCanvas::stroke(Color const& color, Rect rct, Fn&& fn, Term
           utils::max(1l, rct.p2.y/cell_rows + (rct.p2.y%cell_rows != 0)) }
     };
 
+    detail::fixed_color fixed(color);
+
     for (auto ln = block_rect.p1.y; ln < block_rect.p2.y; ++ln) {
         auto line_start = utils::clamp(cell_rows*ln, rct.p1.y, rct.p2.y),
              line_end = utils::clamp(cell_rows*ln + cell_rows, rct.p1.y, rct.p2.y);
@@ -583,7 +908,7 @@ BrailleCanvas& BrailleCanvas::stroke(Color const& color, Rect rct, Fn&& fn, Term
             auto col_start = utils::clamp(cell_cols*col, rct.p1.x, rct.p2.x),
                  col_end = utils::clamp(cell_cols*col + cell_cols, rct.p1.x, rct.p2.x);
 
-            detail::braille::block_t src(color);
+            detail::braille::block_t src(fixed);
 
             for (auto x = col_start; x < col_end; ++x) {
                 auto ybounds = fn(x);
@@ -607,6 +932,8 @@ BrailleCanvas& BrailleCanvas::stroke(Color const& color, Rect rct, Fn&& fn, Term
 
 template<typename Fn>
 BrailleCanvas& BrailleCanvas::fill(Color const& color, Rect rct, Fn&& fn, TerminalOp op) {
+    detail::stats_timer timer(stats_.draw_time);
+
     rct = rct.sorted();
     rct.p2 += Point(1, 1);
     rct = rct.clamp(size());
@@ -620,11 +947,13 @@ BrailleCanvas& BrailleCanvas::fill(Color const& color, Rect rct, Fn&& fn, Termin
         return rct.contains(p) && fn(p);
     };
 
+    detail::fixed_color fixed(color);
+
     for (auto ln = block_rect.p1.y; ln < block_rect.p2.y; ++ln) {
         auto ybase = cell_rows*ln;
         for (auto col = block_rect.p1.x; col < block_rect.p2.x; ++col) {
             auto xbase = cell_cols*col;
-            detail::braille::block_t src(color,
+            detail::braille::block_t src(fixed,
                 set({ xbase, ybase }),
                 set({ xbase, ybase+1 }),
                 set({ xbase, ybase+2 }),
@@ -634,6 +963,9 @@ BrailleCanvas& BrailleCanvas::fill(Color const& color, Rect rct, Fn&& fn, Termin
                 set({ xbase+1, ybase+2 }),
                 set({ xbase+1, ybase+3 }));
 
+            if (fill_backgrounds_ && src.pixels == 0xFF)
+                src = detail::braille::block_t(detail::fixed_color(), 0, fixed);
+
             paint(ln, col, src, op);
         }
     }
@@ -641,6 +973,91 @@ BrailleCanvas& BrailleCanvas::fill(Color const& color, Rect rct, Fn&& fn, Termin
     return *this;
 }
 
+template<typename Iterator>
+BrailleCanvas& BrailleCanvas::scatter(Color const& color, Iterator first, Iterator last, TerminalOp op) {
+    detail::stats_timer timer(stats_.draw_time);
+
+    if (scatter_masks_.size() != blocks_.cells())
+        scatter_masks_.assign(blocks_.cells(), 0);
+
+    // Unsigned comparisons reject negative coordinates too
+    auto width = std::size_t(cell_cols*cols_), height = std::size_t(cell_rows*lines_);
+
+    // Range of touched cells: cheaper to track than a list of cells
+    std::size_t lo = scatter_masks_.size(), hi = 0;
+
+    for (; first != last; ++first) {
+        Point p = *first;
+        auto x = std::size_t(p.x), y = std::size_t(p.y);
+        if (x >= width || y >= height)
+            continue;
+
+        auto index = cols_*(y / cell_rows) + x / cell_cols;
+        lo = utils::min(lo, index);
+        hi = utils::max(hi, index + 1);
+
+        scatter_masks_[index] |= detail::braille::pixel_codes[x % cell_cols][y % cell_rows];
+    }
+
+    detail::fixed_color fixed(color);
+
+    for (auto index = lo; index < hi; ++index) {
+        auto& mask = scatter_masks_[index];
+        if (mask) {
+            auto& dst = blocks_[index];
+            dst = detail::braille::block_t(fixed, mask).paint(dst, op);
+            mask = 0;
+
+            detail::stats_add(stats_.cells_painted);
+        }
+    }
+
+    return *this;
+}
+
+inline void BrailleCanvas::glyph(Color const& color, Point p, std::size_t index, TerminalOp op) {
+    if (p.x % cell_cols == 0 && p.y % cell_rows == 0) {
+        detail::stats_timer timer(stats_.draw_time);
+
+        // Aligned to cells: copy precomputed masks
+        auto const* masks = detail::font_tables<>::cells[index];
+        Coord col = p.x / cell_cols, ln = p.y / cell_rows;
+
+        for (Coord i = 0; i < 4; ++i) {
+            Coord c = col + (i % 2), l = ln + (i / 2);
+            if (masks[i] && c >= 0 && l >= 0 && c < Coord(cols_) && l < Coord(lines_))
+                paint(l, c, detail::braille::block_t(color, masks[i]), op);
+        }
+    } else {
+        auto const* rows = detail::font_tables<>::glyphs[index];
+        Point origin = p + Point(0, detail::braille::glyph_top);
+
+        fill(color, { origin, origin + Point(2, 4) }, [rows,origin](Point px) {
+            return (rows[px.y - origin.y] >> (2 - (px.x - origin.x))) & 1;
+        }, op);
+    }
+}
+
+inline BrailleCanvas& BrailleCanvas::text(Color const& color, Point p, string_view str, TerminalOp op) {
+    Point cursor = p;
+
+    for (auto it = str.begin(), end = str.end(); it != end; it = detail::utf8_next(it, end)) {
+        if (*it == '\n') {
+            cursor = { p.x, cursor.y + detail::braille::glyph_rows };
+            continue;
+        }
+
+        // Glyphs leave their last column blank: boxes never share lit cells
+        auto index = detail::braille::glyph_index(detail::utf8_cp(it, end));
+        if (index)
+            glyph(color, cursor, index, op);
+
+        cursor.x += detail::braille::glyph_cols;
+    }
+
+    return *this;
+}
+
 
 inline std::ostream& operator<<(std::ostream& stream, BrailleCanvas const& canvas) {
     for (auto const& line: canvas)
@@ -651,6 +1068,8 @@ inline std::ostream& operator<<(std::ostream& stream, BrailleCanvas const& canva
 
 
 namespace detail { namespace braille
+{
+inline namespace PLOT_STATS_NAMESPACE
 {
     inline line_t line_t::next() const {
         return { canvas_, std::next(it_, canvas_->cols_) };
@@ -672,19 +1091,70 @@ namespace detail { namespace braille
         // In UTF-8:
         //   0b1110'0010, 0b10'1000'xx 0b10'xxxxxx
 
-        for (auto it = line.it_, end = line.it_+canvas.cols_; it != end; ++it) {
-            if (it->pixels) {
-                stream << term.foreground(it->color.over(canvas.background_).premultiplied())
-                       << char(0b1110'0010)
-                       << char(0b10'1000'00 | ((it->pixels & 0b11'000000) >> 6))
-                       << char(0b10'000000 | (it->pixels & 0b00'111111));
-            } else {
-                stream << ' ';
+        fixed_color background(canvas.background_);
+
+        // Cell position, for ordered dithering
+        Point cell(0, canvas.cols_ ? std::distance(canvas.blocks_.begin(), line.it_)/Coord(canvas.cols_) : 0);
+
+        // The line is assembled in a stack buffer, written in as few chunks
+        // as fit. Colors are tracked as terminal codes: an SGR sequence is
+        // written only where they change, setting foreground and background
+        // together.
+        constexpr std::size_t max_cell_length = max_colors_length + 3;
+        char_buffer<2048> out;
+
+        auto& stats = canvas.stats_;
+        stats_add(stats.lines_rendered);
+
+        auto fg = default_color_code, bg = default_color_code;
+
+        for (auto it = line.it_, end = line.it_+canvas.cols_; it != end;) {
+            {
+                stats_timer timer(stats.render_time);
+
+                for (; it != end && out.room() >= max_cell_length; ++it, ++cell.x) {
+                    auto cell_background = background;
+                    auto bg_code = default_color_code;
+
+                    if (it->background.a) {
+                        cell_background = it->background.over(background);
+                        bg_code = term.color_code(term.dither(cell_background.premultiplied(), cell));
+                    }
+
+                    auto size = out.size();
+
+                    if (it->pixels) {
+                        auto fg_code = term.color_code(term.dither(it->color.over(cell_background).premultiplied(), cell));
+                        term.append_colors(out, fg_code, bg_code, fg, bg);
+                        stats_add(stats.escapes, out.size() != size);
+                        fg = fg_code;
+                        bg = bg_code;
+
+                        out += char(0b1110'0010);
+                        out += char(0b10'1000'00 | ((it->pixels & 0b11'000000) >> 6));
+                        out += char(0b10'000000 | (it->pixels & 0b00'111111));
+                    } else {
+                        term.append_colors(out, fg, bg_code, fg, bg);
+                        stats_add(stats.escapes, out.size() != size);
+                        bg = bg_code;
+
+                        out += ' ';
+                    }
+                }
             }
+
+            {
+                stats_timer timer(stats.write_time);
+                stream.write(out.data(), std::streamsize(out.size()));
+            }
+
+            stats_add(stats.bytes, out.size());
+            out.clear();
         }
 
         return stream << term.reset();
     }
+} /* inline namespace PLOT_STATS_NAMESPACE */
 } /* namespace braille */ } /* namespace detail */
 
 } /* namespace plot */
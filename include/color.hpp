@@ -195,4 +195,94 @@ inline constexpr Color operator/(float const& lhs, Color const& rhs) {
     };
 }
 
+namespace detail
+{
+    // x/65535 rounded to nearest, for x <= 65535*65535
+    inline constexpr std::uint32_t div_65535(std::uint32_t x) {
+        return ((x + 0x8000u) + ((x + 0x8000u) >> 16)) >> 16;
+    }
+
+    // Premultiplied color with 16-bit fixed-point channels (0xFFFF = 1.0).
+    // Canvases store and blend colors in this format: compositing takes
+    // a few integer multiplications and no division.
+    struct fixed_color {
+        constexpr fixed_color() = default;
+
+        constexpr fixed_color(std::uint16_t cmp_r, std::uint16_t cmp_g, std::uint16_t cmp_b, std::uint16_t cmp_a)
+            : r(cmp_r), g(cmp_g), b(cmp_b), a(cmp_a)
+            {}
+
+        // Channels are clamped to [0, 1]
+        explicit fixed_color(Color const& c) {
+            using utils::clamp;
+            auto alpha = clamp(c.a, 0.0f, 1.0f);
+            r = quantize(clamp(c.r, 0.0f, 1.0f)*alpha);
+            g = quantize(clamp(c.g, 0.0f, 1.0f)*alpha);
+            b = quantize(clamp(c.b, 0.0f, 1.0f)*alpha);
+            a = quantize(alpha);
+        }
+
+        // Straight (not premultiplied) color
+        Color color() const {
+            if (!a)
+                return {};
+
+            auto inv = 1.0f/a;
+            return { r*inv, g*inv, b*inv, a/65535.0f };
+        }
+
+        // Premultiplied color, i.e. the color that results from painting
+        // over black: the right input for ANSI color setters after
+        // painting over an opaque background
+        Color premultiplied() const {
+            return { r/65535.0f, g/65535.0f, b/65535.0f, a/65535.0f };
+        }
+
+        constexpr fixed_color over(fixed_color const& dst) const {
+            return {
+                std::uint16_t(r + div_65535(dst.r*(0xFFFFu - a))),
+                std::uint16_t(g + div_65535(dst.g*(0xFFFFu - a))),
+                std::uint16_t(b + div_65535(dst.b*(0xFFFFu - a))),
+                std::uint16_t(a + div_65535(dst.a*(0xFFFFu - a)))
+            };
+        }
+
+        constexpr bool operator==(fixed_color const& other) const {
+            return r == other.r && g == other.g && b == other.b && a == other.a;
+        }
+
+        constexpr bool operator!=(fixed_color const& other) const {
+            return !(*this == other);
+        }
+
+        std::uint16_t r = 0, g = 0, b = 0, a = 0;
+
+    private:
+        static std::uint16_t quantize(float x) {
+            return std::uint16_t(x*65535.0f + 0.5f);
+        }
+    };
+
+    // Weighted mean of three colors with weights summing to at most 8
+    inline fixed_color mix(fixed_color const& c1, std::uint32_t w1,
+                           fixed_color const& c2, std::uint32_t w2,
+                           fixed_color const& c3, std::uint32_t w3) {
+        // Scale weights so that they sum to (at most) 2^16: the mean
+        // is then a sum of products and a shift, with no division
+        static constexpr std::uint32_t unit[9] = {
+            0, 65536, 32768, 21845, 16384, 13107, 10922, 9362, 8192
+        };
+
+        auto u = unit[w1 + w2 + w3];
+        w1 *= u; w2 *= u; w3 *= u;
+
+        return {
+            std::uint16_t((c1.r*w1 + c2.r*w2 + c3.r*w3 + 0x8000u) >> 16),
+            std::uint16_t((c1.g*w1 + c2.g*w2 + c3.g*w3 + 0x8000u) >> 16),
+            std::uint16_t((c1.b*w1 + c2.b*w2 + c3.b*w3 + 0x8000u) >> 16),
+            std::uint16_t((c1.a*w1 + c2.a*w2 + c3.a*w3 + 0x8000u) >> 16)
+        };
+    }
+} /* namespace detail */
+
 } /* namespace plot */
@@ -0,0 +1,2120 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * GENERATED BY scripts/color.py: DO NOT EDIT
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace plot
+{
+
+namespace ansi
+{
+
+namespace detail
+{
+    // Template variables struct members should be linked only once
+    // though appearing in multiple translation units
+    template<typename = void>
+    struct color_tables {
+        // Colors are quantized to quantization_bits per channel; tables are
+        // indexed by (r << 2*quantization_bits) | (g << quantization_bits) | b
+        // and hold the palette entry nearest in OKLab to the center of each bin
+        static constexpr std::size_t quantization_bits = 5;
+
+        // Nearest of the 16 standard colors
+        static const std::uint8_t ansi16[32768];
+
+        // Nearest of the xterm 256 color palette
+        static const std::uint8_t ansi256[32768];
+    };
+
+    template<typename T>
+    constexpr std::size_t color_tables<T>::quantization_bits;
+
+    template<typename T>
+    const std::uint8_t color_tables<T>::ansi16[32768] = {
+        0,0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,
+        0,0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,
+        0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,
+        0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,
+        0,0,0,0,0,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,
+        8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        2,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,8,8,8,8,8,8,8,8,8,8,8,8,6,6,6,6,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,6,6,6,6,6,6,6,6,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,
+        0,0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,
+        0,0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,
+        0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,
+        0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,
+        0,0,0,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,
+        8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,8,8,8,8,8,8,8,8,8,8,8,8,6,6,6,6,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,6,6,6,6,6,6,6,6,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,
+        0,0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,
+        0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,
+        0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,
+        0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,
+        0,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,
+        8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,8,8,8,8,8,8,8,8,8,8,8,8,6,6,6,6,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,6,6,6,6,6,6,6,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,
+        0,0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,
+        0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,
+        0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,
+        0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,
+        8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,
+        8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,8,8,8,8,8,8,8,8,8,8,8,8,6,6,6,6,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,6,6,6,6,6,6,6,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,
+        0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,
+        0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,
+        0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,
+        0,0,0,0,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,
+        8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,8,8,8,8,8,8,8,8,8,8,8,8,6,6,6,6,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,6,6,6,6,6,6,6,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,
+        0,0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,
+        0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,
+        0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,
+        8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,
+        8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,8,8,8,8,8,8,8,8,8,8,8,8,6,6,6,6,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,6,6,6,6,6,6,6,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,
+        0,0,0,0,0,0,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,
+        0,0,0,0,0,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,
+        0,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,
+        8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,8,8,8,8,8,8,8,8,8,8,8,8,6,6,6,6,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,6,6,6,6,6,6,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,
+        0,0,0,0,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,
+        8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,8,8,8,8,8,8,8,8,8,8,8,8,6,6,6,6,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,6,6,6,6,6,6,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,
+        8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,8,8,8,8,8,8,8,8,8,8,8,8,8,6,6,6,6,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,6,6,6,6,6,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,
+        8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,8,8,8,8,8,8,8,8,8,8,8,8,8,6,6,6,6,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,7,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,6,6,6,6,6,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,
+        1,1,1,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,8,8,8,8,8,8,8,8,8,8,8,8,8,6,6,6,6,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,7,7,7,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,6,6,6,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,
+        1,1,1,1,1,1,8,8,8,8,8,8,8,5,4,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,12,
+        1,1,1,1,1,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,12,12,
+        1,1,1,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,4,4,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,4,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,4,4,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,4,4,4,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,4,4,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,8,8,8,8,8,8,8,8,8,8,8,8,8,6,6,6,6,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,7,7,7,7,7,7,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,6,6,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        1,1,1,1,1,1,1,1,8,8,8,8,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,
+        1,1,1,1,1,1,1,1,8,8,8,8,8,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,
+        1,1,1,1,1,1,1,8,8,8,8,8,8,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,
+        1,1,1,1,1,8,8,8,8,8,8,8,8,8,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,5,5,5,5,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,5,5,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        3,3,3,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,3,3,8,8,8,8,8,8,8,8,8,8,8,6,6,6,6,6,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,7,7,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,8,8,8,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,
+        1,1,1,1,1,1,1,1,8,8,8,8,8,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,
+        1,1,1,1,1,1,8,8,8,8,8,8,8,8,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,5,5,5,5,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,5,5,5,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,5,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        3,3,3,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,8,8,8,8,8,8,8,8,6,6,6,6,6,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,3,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,7,7,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,8,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,8,8,8,8,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,
+        1,1,1,1,1,1,1,8,8,8,8,8,8,8,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,
+        1,1,1,8,8,8,8,8,8,8,8,8,8,8,8,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,5,5,5,5,5,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,5,5,5,12,12,12,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,5,12,12,12,12,12,12,12,12,12,12,12,
+        3,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,8,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,8,8,8,8,8,8,6,6,6,6,6,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,3,3,3,3,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,2,2,2,2,2,2,10,10,10,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,7,7,7,7,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,8,8,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,
+        1,1,1,1,1,1,1,1,8,8,8,8,8,8,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,
+        1,1,1,1,8,8,8,8,8,8,8,8,8,8,8,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,5,5,5,5,5,5,5,12,12,12,12,12,12,12,12,
+        3,3,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,5,5,5,5,5,5,12,12,12,12,12,12,12,12,
+        3,3,3,3,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,5,5,5,5,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,8,8,8,8,8,8,8,8,8,8,8,8,8,8,5,5,12,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,8,8,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,8,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,8,8,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,8,8,8,6,6,6,6,6,6,12,12,12,12,12,12,12,12,12,
+        2,2,2,2,3,3,3,3,3,3,3,3,6,6,6,6,6,6,6,6,6,6,6,6,7,7,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,6,6,7,7,7,7,7,7,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,12,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,6,6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,7,7,7,7,7,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,8,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,8,8,8,8,8,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,
+        3,3,3,3,3,1,8,8,8,8,8,8,8,8,8,8,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,8,8,8,8,8,8,8,8,8,8,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,8,8,8,8,8,8,8,8,8,8,5,5,5,5,5,5,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,8,8,8,8,8,8,8,8,8,8,5,5,5,5,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,8,8,8,8,8,8,8,8,8,8,5,12,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,8,8,8,8,8,8,8,8,12,12,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,8,8,8,8,8,8,7,12,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,6,6,7,7,7,7,7,7,7,7,7,7,12,12,12,12,12,12,
+        2,2,2,2,2,2,2,2,2,6,6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,12,12,12,
+        2,2,2,2,2,2,2,2,2,2,6,6,6,6,6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,6,6,6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,6,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,7,7,7,7,7,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,8,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,
+        3,3,3,3,3,3,1,1,1,1,1,8,8,8,8,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,8,8,8,8,8,8,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,8,8,8,8,8,8,5,5,5,5,5,5,5,5,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,8,8,8,8,8,8,5,5,5,5,5,5,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,8,8,8,8,8,8,5,5,5,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,8,8,8,8,8,8,5,12,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,8,8,7,7,7,12,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,7,12,12,12,12,12,
+        2,2,2,2,2,2,2,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,12,12,
+        2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,
+        3,3,3,3,3,3,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,8,8,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,8,8,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,8,8,5,5,5,5,5,5,5,5,5,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,8,8,8,5,5,5,5,5,5,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,8,8,5,5,5,5,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,12,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,12,12,12,12,
+        2,2,2,2,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,12,
+        2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,
+        3,3,3,3,3,3,3,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,5,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,12,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,12,12,12,
+        3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,
+        3,3,3,3,3,3,3,3,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,5,5,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,5,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,12,12,12,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,7,12,12,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,
+        3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,7,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        3,3,3,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        3,3,3,3,3,3,3,3,3,3,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,5,5,5,5,12,12,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,5,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,7,5,5,5,5,5,5,5,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,
+        3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,7,7,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,11,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,11,11,11,14,14,14,14,14,14,14,14,14,14,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        3,3,3,3,3,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        3,3,3,3,3,3,3,3,3,3,3,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,5,5,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,9,9,9,7,5,5,5,5,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,13,
+        3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        2,2,2,2,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,7,7,7,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,14,14,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,11,14,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,11,11,11,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,11,11,11,11,11,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,10,11,11,11,11,11,11,11,14,14,14,14,14,14,14,14,14,14,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        3,3,3,3,3,3,3,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,9,5,5,5,5,5,5,5,5,5,5,5,5,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,9,9,9,5,5,5,5,5,5,5,5,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,9,9,9,9,9,5,5,5,5,5,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,9,9,9,9,9,9,9,5,13,13,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,9,9,9,9,7,7,7,7,7,13,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,13,
+        3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,11,11,7,7,7,7,7,7,7,7,7,7,7,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,10,11,11,11,11,11,14,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,10,11,11,11,11,11,11,11,14,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,10,11,11,11,11,11,11,11,11,11,14,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,10,10,11,11,11,11,11,11,11,11,11,11,11,14,14,14,14,14,14,14,14,14,14,
+        10,10,10,10,10,10,10,10,10,11,11,11,11,11,11,11,11,11,11,11,11,11,11,14,14,14,14,14,14,14,15,15,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,
+        3,3,3,3,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,
+        3,3,3,3,3,3,3,3,3,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,9,9,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,9,9,9,5,5,5,5,5,5,5,5,5,5,5,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,9,9,9,9,9,5,5,5,5,5,5,5,5,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,9,9,9,9,9,9,5,5,5,5,5,13,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,3,9,9,9,9,9,9,9,9,5,5,13,13,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,3,9,9,9,9,9,9,9,9,9,7,7,13,13,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,3,9,9,9,9,9,7,7,7,7,7,7,7,7,7,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,13,13,
+        3,3,3,3,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,10,11,11,11,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        10,10,10,10,10,10,10,10,11,11,11,11,11,11,11,11,11,7,7,7,7,7,7,7,7,7,7,14,14,14,14,15,
+        10,10,10,10,10,10,10,11,11,11,11,11,11,11,11,11,11,11,11,11,14,14,14,14,14,14,14,14,14,14,15,15,
+        10,10,10,10,10,10,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,14,14,14,14,14,14,14,14,15,15,15,
+        10,10,10,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,14,14,14,14,14,14,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,14,14,14,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,14,15,15,15,15,15,15,15,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,13,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,13,
+        3,3,3,3,3,3,1,1,1,1,1,1,9,9,9,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,9,9,9,9,9,9,5,5,5,5,5,5,5,5,5,5,5,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,9,9,9,9,9,9,9,5,5,5,5,5,5,5,5,5,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,9,9,9,9,9,9,9,9,5,5,5,5,5,5,5,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,9,9,9,9,9,9,9,9,9,5,5,5,5,5,13,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,3,9,9,9,9,9,9,9,9,9,9,9,5,13,13,13,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,3,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,3,9,9,9,9,9,9,9,9,9,9,9,7,7,7,7,7,13,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,3,9,9,9,9,9,9,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,13,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        11,11,11,11,11,11,11,11,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,7,7,7,7,7,7,7,7,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,14,14,14,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,14,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,13,13,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,9,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,13,13,
+        1,1,1,1,1,1,1,1,1,1,1,1,9,9,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,13,13,
+        1,1,1,1,1,1,1,1,1,1,1,9,9,9,5,5,5,5,5,5,5,5,5,5,5,5,5,5,13,13,13,13,
+        1,1,1,1,1,1,1,1,1,1,9,9,9,9,9,5,5,5,5,5,5,5,5,5,5,5,5,13,13,13,13,13,
+        3,3,3,3,1,1,1,1,9,9,9,9,9,9,9,5,5,5,5,5,5,5,5,5,5,5,5,13,13,13,13,13,
+        3,3,3,3,3,3,9,9,9,9,9,9,9,9,9,9,5,5,5,5,5,5,5,5,5,5,13,13,13,13,13,13,
+        3,3,3,3,3,3,9,9,9,9,9,9,9,9,9,9,9,5,5,5,5,5,5,5,5,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,9,9,9,9,9,9,9,9,9,9,9,9,5,5,5,5,5,5,13,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,9,9,9,9,9,9,9,9,9,9,9,9,9,5,5,5,5,13,13,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,
+        3,3,3,3,3,3,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,
+        3,3,3,3,3,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,
+        3,3,3,3,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,
+        3,3,3,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,7,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,7,7,7,7,7,7,7,7,13,13,13,13,13,13,13,
+        9,9,9,9,9,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        11,11,11,11,11,11,11,11,11,11,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,7,7,7,7,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,
+        1,1,1,1,1,1,1,9,9,9,9,9,9,9,9,5,5,5,5,5,5,5,5,5,5,5,13,13,13,13,13,13,
+        1,1,1,1,1,1,9,9,9,9,9,9,9,9,9,5,5,5,5,5,5,5,5,5,5,5,13,13,13,13,13,13,
+        1,1,1,1,9,9,9,9,9,9,9,9,9,9,9,9,5,5,5,5,5,5,5,5,5,5,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,5,5,5,5,5,5,5,5,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,5,5,5,5,5,5,5,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,5,5,5,5,5,5,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,5,5,5,5,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,5,5,5,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,7,7,7,7,7,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,13,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        11,11,11,11,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        11,11,11,11,11,11,11,11,11,11,11,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,7,7,7,7,7,7,7,7,7,7,7,7,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,5,5,5,5,5,5,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,5,5,5,5,5,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,5,5,5,5,5,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,5,5,5,5,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,5,5,5,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,5,5,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,7,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,7,7,7,7,7,7,7,7,13,13,13,13,13,13,
+        9,9,9,9,9,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        11,11,11,11,11,11,11,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        11,11,11,11,11,11,11,11,11,11,11,11,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,7,7,7,7,7,7,7,7,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,5,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,5,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,5,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,7,7,7,7,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        11,11,11,11,11,11,11,11,11,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,7,7,7,7,7,7,7,7,7,7,7,7,7,7,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,7,7,7,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,7,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,7,7,7,7,7,7,7,7,13,13,13,13,13,13,
+        9,9,9,9,9,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,
+        11,11,11,11,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        11,11,11,11,11,11,11,11,11,11,11,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,7,7,7,7,7,7,7,7,7,7,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,13,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,7,7,7,13,13,13,13,13,13,13,
+        9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,13,13,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,13,
+        11,11,11,11,11,11,11,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,
+        11,11,11,11,11,11,11,11,11,11,11,11,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,7,7,7,7,7,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,15,
+        11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,11,15,15,15,15,15,15,15,15,15,
+    };
+
+    template<typename T>
+    const std::uint8_t color_tables<T>::ansi256[32768] = {
+        0,0,232,232,232,232,17,17,17,17,17,17,17,17,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        232,232,232,232,232,232,233,17,17,17,17,17,17,17,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        232,232,233,233,233,233,233,17,17,17,17,17,17,17,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        233,233,233,233,233,233,234,234,17,17,17,17,17,17,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        234,234,234,234,234,234,234,234,234,17,17,17,17,18,18,18,18,18,4,4,4,19,19,20,20,20,20,20,21,21,21,21,
+        234,234,234,235,235,235,235,235,235,235,235,17,18,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,21,
+        235,235,235,235,235,235,235,235,236,236,236,236,236,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,21,
+        236,236,236,236,236,236,236,236,236,236,236,237,237,237,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,21,21,
+        22,22,22,237,237,237,237,237,237,237,237,237,237,237,24,24,24,24,25,25,25,25,25,25,26,26,26,26,26,21,27,27,
+        22,22,22,22,22,22,237,237,237,238,238,23,23,24,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,22,22,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,26,26,26,26,26,27,27,27,
+        28,28,28,22,22,22,22,29,29,29,29,29,23,23,30,30,30,24,24,31,31,31,25,25,32,32,26,26,26,27,27,27,
+        28,28,28,28,28,28,28,29,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,28,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,28,28,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,28,28,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,33,33,33,
+        2,2,2,2,2,2,2,2,35,35,35,35,35,36,36,36,36,6,6,6,6,6,6,6,38,38,38,38,39,39,39,39,
+        2,2,2,2,2,2,2,2,35,35,35,35,35,35,36,36,36,36,6,6,6,6,6,6,38,38,38,38,38,39,39,39,
+        34,34,34,2,2,2,2,2,35,35,35,35,35,35,36,36,36,36,36,6,6,37,37,37,38,38,38,38,38,39,39,39,
+        34,34,34,34,34,34,34,34,34,35,35,35,35,35,35,36,36,36,36,36,37,37,37,37,37,38,38,38,38,39,39,39,
+        34,34,34,34,34,34,34,34,34,34,35,35,35,35,35,35,36,36,36,36,37,37,37,37,37,38,38,38,38,38,39,39,
+        40,40,40,40,40,40,40,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,45,
+        40,40,40,40,40,40,40,41,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,45,45,45,45,
+        40,40,40,40,40,40,40,40,41,41,41,41,41,41,41,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,
+        40,40,40,40,40,40,40,40,40,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,
+        40,40,40,40,40,40,40,40,76,76,76,41,41,41,41,77,42,42,42,42,78,43,43,43,43,44,44,44,44,44,45,45,
+        46,46,46,46,46,46,47,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,50,51,51,51,51,
+        46,46,46,46,46,46,46,46,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,51,51,51,51,
+        46,46,46,46,46,46,46,46,46,47,47,47,47,47,47,48,48,48,48,49,49,49,49,49,50,50,50,50,50,51,51,51,
+        232,232,232,232,232,232,17,17,17,17,17,17,17,17,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        232,232,232,232,232,233,233,17,17,17,17,17,17,17,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        233,233,233,233,233,233,233,17,17,17,17,17,17,17,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        233,233,233,233,233,234,234,234,17,17,17,17,17,18,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        234,234,234,234,234,234,234,234,235,17,17,17,17,18,18,18,18,18,4,4,4,19,19,20,20,20,20,20,21,21,21,21,
+        234,235,235,235,235,235,235,235,235,235,235,17,18,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,21,
+        235,235,235,235,235,235,235,236,236,236,236,236,236,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,21,
+        236,236,236,236,236,236,236,236,236,236,237,237,237,237,237,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,21,21,
+        22,22,237,237,237,237,237,237,237,237,237,237,237,237,24,24,24,24,25,25,25,25,25,25,26,26,26,26,26,21,27,27,
+        22,22,22,22,22,237,237,237,238,238,238,238,23,24,24,24,24,24,25,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,22,22,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,26,26,26,26,26,27,27,27,
+        28,28,28,22,22,22,22,29,29,29,29,29,23,23,30,30,30,24,24,31,31,31,25,25,32,32,26,26,26,27,27,27,
+        28,28,28,28,28,28,28,29,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,28,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,28,28,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,28,28,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,33,33,33,
+        2,2,2,2,2,2,2,2,35,35,35,35,35,36,36,36,36,6,6,6,6,6,6,6,38,38,38,38,39,39,39,39,
+        2,2,2,2,2,2,2,2,35,35,35,35,35,35,36,36,36,36,6,6,6,6,6,6,38,38,38,38,39,39,39,39,
+        34,34,34,2,2,2,2,2,35,35,35,35,35,35,36,36,36,36,36,6,6,37,37,37,38,38,38,38,38,39,39,39,
+        34,34,34,34,34,34,34,34,34,35,35,35,35,35,35,36,36,36,36,36,37,37,37,37,37,38,38,38,38,39,39,39,
+        34,34,34,34,34,34,34,34,34,70,35,35,35,35,35,35,36,36,36,36,37,37,37,37,37,38,38,38,38,38,39,39,
+        40,40,40,40,40,40,41,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,45,
+        40,40,40,40,40,40,40,41,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,45,45,45,45,
+        40,40,40,40,40,40,40,40,41,41,41,41,41,41,41,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,
+        40,40,40,40,40,40,40,40,40,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,
+        40,40,40,40,40,40,40,40,76,76,76,41,41,41,41,77,42,42,42,42,78,43,43,43,79,44,44,44,44,80,45,45,
+        46,46,46,46,46,46,47,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,50,51,51,51,51,
+        46,46,46,46,46,46,46,47,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,51,51,51,51,
+        46,46,46,46,46,46,46,46,46,47,47,47,47,47,47,48,48,48,48,49,49,49,49,49,50,50,50,50,50,51,51,51,
+        232,232,232,232,232,232,233,17,17,17,17,17,17,17,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        232,232,232,232,233,233,233,17,17,17,17,17,17,17,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        233,233,233,233,233,233,233,17,17,17,17,17,17,17,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        233,233,233,233,234,234,234,234,17,17,17,17,17,18,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        234,234,234,234,234,234,234,234,235,235,17,17,17,18,18,18,18,18,4,4,4,19,19,20,20,20,20,20,21,21,21,21,
+        235,235,235,235,235,235,235,235,235,235,235,17,18,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,21,
+        235,235,235,235,235,235,236,236,236,236,236,236,236,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,21,
+        236,236,236,236,236,236,236,236,236,236,237,237,237,237,237,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,21,21,
+        22,22,237,237,237,237,237,237,237,237,237,237,237,238,24,24,24,24,25,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,237,237,238,238,238,238,238,238,24,24,24,24,24,25,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,22,22,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,26,26,26,26,26,27,27,27,
+        28,28,28,28,22,22,22,29,29,29,29,29,29,23,30,30,30,24,24,31,31,31,25,25,32,32,26,26,26,33,27,27,
+        28,28,28,28,28,28,28,29,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,28,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,28,29,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,28,28,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,33,33,33,
+        2,2,2,2,2,2,2,2,35,35,35,35,35,36,36,36,36,6,6,6,6,6,6,6,38,38,38,38,39,39,39,39,
+        2,2,2,2,2,2,2,2,35,35,35,35,35,35,36,36,36,36,6,6,6,6,6,6,38,38,38,38,39,39,39,39,
+        34,34,34,34,2,2,2,2,35,35,35,35,35,35,36,36,36,36,36,6,6,37,37,37,38,38,38,38,38,39,39,39,
+        34,34,34,34,34,34,34,34,34,35,35,35,35,35,35,36,36,36,36,36,37,37,37,37,37,38,38,38,38,39,39,39,
+        34,34,34,34,34,34,34,34,34,70,35,35,35,35,35,35,36,36,36,36,37,37,37,37,37,38,38,38,38,38,39,39,
+        40,40,40,40,40,40,41,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,45,
+        40,40,40,40,40,40,40,41,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,45,45,45,45,
+        40,40,40,40,40,40,40,40,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,
+        40,40,40,40,40,40,40,40,40,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,
+        40,40,40,40,40,40,40,76,76,76,76,41,41,41,41,77,42,42,42,78,78,43,43,43,79,44,44,44,44,80,45,45,
+        46,46,46,46,46,46,47,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,50,51,51,51,51,
+        46,46,46,46,46,46,46,47,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,51,51,51,51,
+        46,46,46,46,46,46,46,46,47,47,47,47,47,47,47,48,48,48,48,49,49,49,49,49,50,50,50,50,50,51,51,51,
+        232,232,232,232,232,233,233,17,17,17,17,17,17,17,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        233,233,233,233,233,233,233,17,17,17,17,17,17,17,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        233,233,233,233,233,233,234,234,17,17,17,17,17,17,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        234,234,234,234,234,234,234,234,234,17,17,17,17,18,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        234,234,234,234,234,234,235,235,235,235,17,17,17,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,21,
+        235,235,235,235,235,235,235,235,235,235,236,236,18,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,21,
+        235,235,235,235,235,236,236,236,236,236,236,236,236,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,21,
+        236,236,236,236,236,236,236,236,236,237,237,237,237,237,237,24,4,4,4,19,19,19,20,20,20,20,20,21,21,21,21,21,
+        22,237,237,237,237,237,237,237,237,237,237,237,237,238,24,24,24,24,25,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,237,238,238,238,238,238,238,238,24,24,24,24,24,25,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,22,22,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,26,26,26,26,26,27,27,27,
+        28,28,28,28,28,22,22,29,29,29,29,29,29,30,30,30,30,24,31,31,31,31,25,25,32,32,32,26,26,33,33,33,
+        28,28,28,28,28,28,28,29,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,28,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,28,29,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,28,28,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,33,33,33,
+        2,2,2,2,2,2,2,2,35,35,35,35,35,36,36,36,36,6,6,6,6,6,6,6,38,38,38,38,39,39,39,39,
+        2,2,2,2,2,2,2,2,35,35,35,35,35,35,36,36,36,36,6,6,6,6,6,6,38,38,38,38,39,39,39,39,
+        34,34,34,34,2,2,2,2,35,35,35,35,35,35,36,36,36,36,36,6,6,37,37,37,38,38,38,38,38,39,39,39,
+        34,34,34,34,34,34,34,34,34,35,35,35,35,35,35,36,36,36,36,36,37,37,37,37,37,38,38,38,38,39,39,39,
+        34,34,34,34,34,34,34,34,70,70,35,35,35,35,35,35,36,36,36,36,37,37,37,37,37,38,38,38,38,38,39,39,
+        40,40,40,40,40,40,41,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,45,
+        40,40,40,40,40,40,40,41,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,44,44,44,44,44,45,45,45,45,
+        40,40,40,40,40,40,40,40,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,
+        40,40,40,40,40,40,40,40,40,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,45,45,45,
+        40,40,40,40,40,40,76,76,76,76,76,41,41,41,77,77,42,42,42,78,78,43,43,43,79,79,44,44,44,80,45,45,
+        46,46,46,46,46,46,47,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,50,51,51,51,51,
+        46,46,46,46,46,46,46,47,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,51,51,51,51,
+        46,46,46,46,46,46,46,46,47,47,47,47,47,47,47,48,48,48,48,49,49,49,49,49,50,50,50,50,50,51,51,51,
+        232,233,233,233,233,233,233,17,17,17,17,17,17,17,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        233,233,233,233,233,233,233,234,17,17,17,17,17,17,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        233,233,233,233,234,234,234,234,17,17,17,17,17,18,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        234,234,234,234,234,234,234,234,234,17,17,17,17,18,18,18,18,18,4,4,4,19,19,20,20,20,20,20,21,21,21,21,
+        234,234,234,234,234,235,235,235,235,235,235,17,17,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,21,
+        235,235,235,235,235,235,235,235,235,236,236,236,18,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,21,
+        236,236,236,236,236,236,236,236,236,236,236,236,237,237,18,18,18,4,4,19,19,19,20,20,20,20,20,20,21,21,21,21,
+        236,236,236,236,236,236,236,236,237,237,237,237,237,237,237,24,24,4,4,19,19,19,20,20,20,20,20,21,21,21,21,21,
+        22,237,237,237,237,237,237,237,237,237,237,237,238,238,24,24,24,24,25,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,238,238,238,238,238,238,238,238,24,24,24,24,24,25,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,23,23,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,26,26,26,26,26,27,27,27,
+        28,28,28,28,28,22,29,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,33,
+        28,28,28,28,28,28,28,29,29,29,29,29,29,29,30,30,30,30,31,31,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,28,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,28,29,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,28,28,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,33,33,33,
+        2,2,2,2,2,2,2,2,35,35,35,35,35,36,36,36,36,6,6,6,6,6,6,6,38,38,38,38,39,39,39,39,
+        2,2,2,2,2,2,2,2,35,35,35,35,35,35,36,36,36,36,6,6,6,6,6,6,38,38,38,38,39,39,39,39,
+        34,34,34,34,34,2,2,2,35,35,35,35,35,35,36,36,36,36,36,6,6,37,37,37,38,38,38,38,38,39,39,39,
+        34,34,34,34,34,34,34,34,34,35,35,35,35,35,35,36,36,36,36,36,37,37,37,37,37,38,38,38,38,39,39,39,
+        34,34,34,34,34,34,34,70,70,70,35,35,35,35,35,71,36,36,36,36,37,37,37,37,37,38,38,38,38,38,39,39,
+        40,40,40,40,40,40,41,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,45,
+        40,40,40,40,40,40,40,41,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,44,44,44,44,44,45,45,45,45,
+        40,40,40,40,40,40,40,40,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,
+        40,40,40,40,40,40,40,40,40,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,45,45,45,
+        40,40,40,40,40,76,76,76,76,76,76,41,41,77,77,77,42,42,78,78,78,43,43,79,79,79,44,44,80,80,45,45,
+        46,46,46,46,46,46,47,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,50,51,51,51,51,
+        46,46,46,46,46,46,46,47,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,51,51,51,51,
+        46,46,46,46,46,46,46,46,47,47,47,47,47,47,47,48,48,48,48,49,49,49,49,49,50,50,50,50,50,51,51,51,
+        233,233,233,233,233,233,234,234,17,17,17,17,17,17,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        233,233,233,233,234,234,234,234,234,17,17,17,17,18,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        234,234,234,234,234,234,234,234,234,17,17,17,17,18,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        234,234,234,234,234,234,234,235,235,235,17,17,17,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,21,
+        235,235,235,235,235,235,235,235,235,235,235,236,18,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,21,
+        235,235,235,235,235,235,235,236,236,236,236,236,236,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,21,
+        236,236,236,236,236,236,236,236,236,236,236,237,237,237,18,18,18,4,4,19,19,19,20,20,20,20,20,20,21,21,21,21,
+        236,236,236,236,236,236,237,237,237,237,237,237,237,237,237,24,24,24,4,25,25,25,20,20,20,20,20,21,21,21,21,21,
+        237,237,237,237,237,237,237,237,237,237,237,238,238,238,24,24,24,24,25,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,238,238,238,238,238,238,238,238,238,238,24,24,24,24,25,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,22,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,26,26,26,26,26,27,27,27,
+        28,28,28,28,28,28,29,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,33,
+        28,28,28,28,28,28,28,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,29,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,28,29,29,29,29,29,29,29,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,64,64,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,33,33,33,
+        2,2,2,2,2,2,2,2,35,35,35,35,35,36,36,36,36,6,6,6,6,6,6,38,38,38,38,38,39,39,39,39,
+        2,2,2,2,2,2,2,2,35,35,35,35,35,35,36,36,36,36,6,6,6,6,6,6,38,38,38,38,39,39,39,39,
+        34,34,34,34,34,34,2,2,35,35,35,35,35,35,36,36,36,36,36,6,37,37,37,37,38,38,38,38,38,39,39,39,
+        34,34,34,34,34,34,34,34,70,35,35,35,35,35,35,36,36,36,36,36,37,37,37,37,38,38,38,38,38,39,39,39,
+        34,34,34,34,34,70,70,70,70,70,35,35,35,35,71,71,36,36,36,72,72,37,37,37,73,38,38,38,38,74,39,39,
+        40,40,40,40,40,40,41,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,45,
+        40,40,40,40,40,40,40,41,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,44,44,44,44,44,45,45,45,45,
+        40,40,40,40,40,40,40,40,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,
+        40,40,40,40,40,40,40,76,76,41,41,41,41,41,41,42,42,42,42,78,43,43,43,43,79,44,44,44,44,45,45,45,
+        40,40,76,76,76,76,76,76,76,76,76,41,41,77,77,77,42,78,78,78,78,43,79,79,79,79,44,80,80,80,45,45,
+        46,46,46,46,46,46,47,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,50,51,51,51,51,
+        46,46,46,46,46,46,46,47,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,51,51,51,51,
+        46,46,46,46,46,46,46,46,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,50,51,51,51,
+        233,233,233,234,234,234,234,234,234,53,17,17,17,18,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        234,234,234,234,234,234,234,234,234,53,17,17,17,18,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,
+        234,234,234,234,234,234,234,235,235,235,53,17,17,18,18,18,18,18,4,4,4,19,19,20,20,20,20,20,21,21,21,21,
+        234,234,234,234,235,235,235,235,235,235,235,53,53,18,18,18,18,18,4,4,19,19,19,20,20,20,20,20,21,21,21,21,
+        235,235,235,235,235,235,235,235,235,236,236,236,53,18,18,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,21,
+        235,235,235,235,235,236,236,236,236,236,236,236,236,53,54,18,18,4,4,4,19,19,19,20,20,20,20,20,21,21,21,21,
+        236,236,236,236,236,236,236,236,236,236,237,237,237,237,237,54,54,4,4,19,19,19,20,20,20,20,20,21,21,21,21,21,
+        236,236,237,237,237,237,237,237,237,237,237,237,237,237,238,24,24,24,25,25,25,25,25,20,20,26,26,26,21,21,21,27,
+        237,237,237,237,237,237,237,237,237,237,238,238,238,238,238,24,24,24,25,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,238,238,238,238,238,238,238,238,238,238,24,24,24,24,25,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,238,239,239,239,239,239,239,24,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,23,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,22,58,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,22,58,58,58,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,26,26,26,26,26,27,27,27,
+        28,28,28,28,28,28,29,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,33,
+        28,28,28,28,28,28,28,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,29,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,28,28,64,29,29,29,29,29,29,29,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,28,64,64,64,64,64,29,29,29,29,65,65,30,30,30,66,31,31,31,31,67,32,32,32,32,33,33,33,
+        2,2,2,2,2,2,2,35,35,35,35,35,35,36,36,36,36,6,6,6,6,6,6,38,38,38,38,38,39,39,39,39,
+        2,2,2,2,2,2,2,2,35,35,35,35,35,36,36,36,36,36,6,6,6,6,6,6,38,38,38,38,39,39,39,39,
+        34,34,34,34,34,34,34,2,35,35,35,35,35,35,36,36,36,36,36,6,37,37,37,37,38,38,38,38,38,39,39,39,
+        34,34,34,34,34,34,70,70,70,35,35,35,35,35,71,36,36,36,36,72,37,37,37,37,38,38,38,38,38,39,39,39,
+        34,34,70,70,70,70,70,70,70,70,35,35,35,71,71,71,36,72,72,72,72,37,73,73,73,38,38,74,74,74,39,39,
+        40,40,40,40,40,40,41,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,45,
+        40,40,40,40,40,40,40,41,41,41,41,41,41,41,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,45,
+        40,40,40,40,40,40,40,40,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,
+        40,40,40,40,40,76,76,76,76,41,41,41,41,41,77,42,42,42,78,78,43,43,43,79,79,44,44,44,80,80,45,45,
+        76,76,76,76,76,76,76,76,76,76,76,77,77,77,77,77,77,78,78,78,78,79,79,79,79,79,80,80,80,80,45,81,
+        46,46,46,46,46,46,47,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,50,51,51,51,51,
+        46,46,46,46,46,46,46,47,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,50,50,50,50,50,51,51,51,51,
+        46,46,46,46,46,46,46,46,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,50,51,51,51,
+        234,234,234,234,234,234,234,53,53,53,53,53,53,53,54,54,54,54,54,4,4,19,19,20,20,20,20,20,21,21,21,21,
+        234,234,234,234,234,234,234,235,53,53,53,53,53,53,54,54,54,54,55,55,55,19,19,20,20,20,20,20,21,21,21,21,
+        234,234,234,234,235,235,235,235,53,53,53,53,53,53,54,54,54,54,55,55,55,55,19,20,20,20,20,20,21,21,21,21,
+        235,235,235,235,235,235,235,235,235,53,53,53,53,53,54,54,54,54,55,55,55,55,55,20,20,20,20,20,21,21,21,21,
+        235,235,235,235,235,235,235,236,236,236,236,53,53,53,54,54,54,54,55,55,55,55,55,56,56,56,56,56,21,21,21,21,
+        236,236,236,236,236,236,236,236,236,236,236,236,53,53,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        236,236,236,236,236,236,236,236,237,237,237,237,237,237,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        237,237,237,237,237,237,237,237,237,237,237,237,237,238,238,24,54,54,55,55,55,55,56,56,56,56,56,56,57,57,57,57,
+        237,237,237,237,237,237,237,238,238,238,238,238,238,238,238,24,24,24,25,25,25,25,25,26,26,26,26,26,26,12,12,12,
+        22,22,22,238,238,238,238,238,238,238,238,238,239,239,24,24,24,24,25,25,25,25,25,25,26,26,26,26,26,12,12,12,
+        22,22,22,22,22,239,239,239,239,239,239,239,239,239,24,24,24,24,25,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,22,58,58,23,23,23,23,23,23,8,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,22,22,22,58,58,58,58,23,23,23,23,23,23,24,24,24,24,24,25,25,25,25,25,26,26,26,26,26,27,27,27,
+        22,58,58,58,58,58,58,58,58,23,23,23,59,241,241,241,24,60,60,60,25,25,61,61,26,26,26,62,62,27,27,27,
+        28,28,28,28,58,58,58,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,33,
+        28,28,28,28,28,28,29,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,33,
+        28,28,28,28,28,28,64,29,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,
+        28,28,28,28,64,64,64,64,64,29,29,29,29,29,65,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,
+        64,64,64,64,64,64,64,64,64,64,29,29,65,65,65,65,66,66,66,66,66,67,67,67,67,32,68,68,68,68,69,69,
+        2,2,2,2,2,2,2,35,35,35,35,35,35,36,36,36,36,6,6,6,6,6,6,38,38,38,38,38,39,39,39,39,
+        2,2,2,2,2,2,2,35,35,35,35,35,35,36,36,36,36,36,6,6,6,6,6,38,38,38,38,38,39,39,39,39,
+        34,34,34,34,34,34,34,70,35,35,35,35,35,35,36,36,36,36,36,37,37,37,37,37,38,38,38,38,38,39,39,39,
+        34,34,34,70,70,70,70,70,70,35,35,35,35,71,71,36,36,36,72,72,37,37,37,73,73,38,38,74,74,39,39,39,
+        70,70,70,70,70,70,70,70,70,70,70,71,71,71,71,71,72,72,72,72,72,73,73,73,73,74,74,74,74,74,75,75,
+        40,40,40,40,40,40,41,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,45,
+        40,40,40,40,40,40,40,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,45,
+        40,40,40,40,40,40,40,76,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,
+        40,76,76,76,76,76,76,76,76,76,41,41,77,77,77,77,42,78,78,78,43,43,79,79,79,44,44,80,80,80,45,81,
+        76,76,76,76,76,76,76,76,76,76,76,77,77,77,77,77,78,78,78,78,78,79,79,79,79,79,80,80,80,80,81,81,
+        46,46,46,46,46,47,47,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,50,51,51,51,51,
+        46,46,46,46,46,46,46,47,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,50,50,50,50,50,51,51,51,51,
+        46,46,46,46,46,46,82,82,10,10,47,47,47,47,48,48,48,48,84,49,49,49,49,85,50,50,50,50,86,51,51,51,
+        52,52,52,52,52,52,53,53,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,235,53,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,235,235,53,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,57,57,57,57,
+        52,52,235,235,235,235,235,235,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        235,235,235,236,236,236,236,236,236,236,53,53,53,53,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        236,236,236,236,236,236,236,236,236,236,237,53,53,53,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        236,236,236,236,236,237,237,237,237,237,237,237,237,53,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        237,237,237,237,237,237,237,237,237,237,237,238,238,238,238,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        237,237,237,238,238,238,238,238,238,238,238,238,238,238,238,24,24,24,25,25,25,25,25,26,26,26,26,26,12,12,12,12,
+        22,22,238,238,238,238,238,238,238,238,238,239,239,239,239,24,24,24,25,25,25,25,25,25,26,26,26,26,12,12,12,12,
+        22,58,58,58,58,239,239,239,239,239,239,239,239,239,24,24,24,24,25,25,25,25,25,25,26,26,26,26,12,12,12,12,
+        58,58,58,58,58,58,58,8,8,8,8,8,8,240,240,24,24,60,60,25,25,25,61,61,26,26,26,26,12,12,12,12,
+        58,58,58,58,58,58,58,58,58,240,240,240,59,59,59,60,60,60,60,60,61,61,61,61,62,62,62,62,62,12,12,12,
+        58,58,58,58,58,58,58,58,58,58,59,241,241,241,241,241,60,60,60,60,61,61,61,61,61,62,62,62,62,63,63,63,
+        28,28,58,58,58,58,58,29,29,29,29,29,242,242,242,242,242,60,60,31,31,31,61,61,32,32,32,62,62,33,33,63,
+        28,28,28,28,28,64,29,29,29,29,29,29,29,30,30,30,30,30,31,31,31,31,31,32,32,32,32,32,33,33,33,33,
+        28,28,64,64,64,64,64,64,29,29,29,29,29,65,30,30,30,30,66,31,31,31,31,67,32,32,32,32,68,33,33,33,
+        64,64,64,64,64,64,64,64,64,29,29,65,65,65,65,30,66,66,66,66,67,67,67,67,67,68,68,68,68,69,69,69,
+        64,64,64,64,64,64,64,64,64,64,65,65,65,65,65,65,66,66,66,66,66,67,67,67,67,68,68,68,68,68,69,69,
+        2,2,2,2,2,2,2,35,35,35,35,35,35,36,36,36,36,6,6,6,6,6,6,38,38,38,38,38,39,39,39,39,
+        2,2,2,2,2,2,2,35,35,35,35,35,35,36,36,36,36,36,6,6,6,6,6,38,38,38,38,38,39,39,39,39,
+        34,34,34,70,70,70,70,70,35,35,35,35,35,71,36,36,36,36,72,37,37,37,73,73,38,38,38,38,74,39,39,39,
+        70,70,70,70,70,70,70,70,70,70,35,71,71,71,71,36,72,72,72,72,73,73,73,73,73,74,74,74,74,74,75,75,
+        70,70,70,70,70,70,70,70,70,70,70,71,71,71,71,71,72,72,72,72,72,73,73,73,73,74,74,74,74,74,75,75,
+        40,40,40,40,40,41,41,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,45,
+        40,40,40,40,40,40,41,41,41,41,41,41,41,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,45,
+        40,40,40,76,76,76,76,76,41,41,41,41,41,77,42,42,42,78,78,43,43,43,79,79,44,44,44,80,80,45,45,45,
+        76,76,76,76,76,76,76,76,76,76,77,77,77,77,77,77,78,78,78,78,79,79,79,79,79,80,80,80,80,80,81,81,
+        76,76,76,76,76,76,76,76,76,76,76,77,77,77,77,77,78,78,78,78,78,79,79,79,79,79,80,80,80,80,81,81,
+        46,46,46,46,46,47,47,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,50,51,51,51,51,
+        46,46,46,46,46,46,47,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,50,51,51,51,51,
+        46,46,82,82,82,82,82,82,10,10,10,10,10,83,83,48,48,84,84,49,49,49,85,85,50,50,50,86,86,51,51,14,
+        52,52,52,52,52,52,53,53,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,53,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,53,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,53,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,236,236,236,236,236,53,53,53,53,53,54,54,54,54,54,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        236,236,236,236,236,236,236,237,237,237,53,53,53,53,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        237,237,237,237,237,237,237,237,237,237,237,237,53,53,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        237,237,237,237,237,237,237,237,238,238,238,238,238,238,238,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        238,238,238,238,238,238,238,238,238,238,238,238,238,238,239,60,60,60,61,61,61,61,61,56,56,56,56,12,12,12,12,12,
+        58,58,238,238,238,238,238,238,239,239,239,239,239,239,239,60,60,60,61,61,61,61,61,61,62,62,62,12,12,12,12,12,
+        58,58,58,58,58,239,239,239,239,239,239,239,8,8,8,60,60,60,60,61,61,61,61,61,62,62,62,62,12,12,12,12,
+        58,58,58,58,58,58,58,8,8,8,8,240,240,240,240,60,60,60,60,61,61,61,61,61,62,62,62,62,62,12,12,12,
+        58,58,58,58,58,58,58,58,58,240,59,59,59,59,59,60,60,60,60,60,61,61,61,61,62,62,62,62,62,63,63,63,
+        58,58,58,58,58,58,58,58,58,241,241,241,241,241,241,241,60,60,60,60,61,61,61,61,61,62,62,62,62,63,63,63,
+        58,58,58,58,58,58,58,58,29,29,29,242,242,242,242,242,242,242,60,60,31,61,61,61,32,62,62,62,62,63,63,63,
+        64,64,64,64,64,64,64,29,29,29,29,65,65,65,30,30,66,66,66,31,67,67,67,67,32,68,68,68,68,33,33,69,
+        64,64,64,64,64,64,64,64,29,65,65,65,65,65,65,66,66,66,66,67,67,67,67,67,68,68,68,68,68,69,69,69,
+        64,64,64,64,64,64,64,64,64,65,65,65,65,65,65,66,66,66,66,66,67,67,67,67,67,68,68,68,68,69,69,69,
+        64,64,64,64,64,64,64,64,64,64,65,65,65,65,65,65,66,66,66,66,67,67,67,67,67,68,68,68,68,68,69,69,
+        2,2,2,2,2,2,2,35,35,35,35,35,36,36,36,36,36,6,6,6,6,6,6,38,38,38,38,68,39,39,39,39,
+        2,2,2,2,2,2,70,35,35,35,35,35,71,36,36,36,36,72,6,6,6,6,6,38,38,38,38,74,39,39,39,39,
+        70,70,70,70,70,70,70,70,35,35,71,71,71,71,71,72,72,72,72,37,73,73,73,73,38,74,74,74,74,75,75,75,
+        70,70,70,70,70,70,70,70,70,70,71,71,71,71,71,72,72,72,72,72,73,73,73,73,73,74,74,74,74,74,75,75,
+        70,70,70,70,70,70,70,70,70,70,71,71,71,71,71,71,72,72,72,72,72,73,73,73,73,74,74,74,74,74,75,75,
+        40,40,40,40,40,41,41,41,41,41,41,41,42,42,42,42,42,42,43,43,43,43,43,44,44,44,44,44,45,45,45,45,
+        40,40,40,76,76,76,76,41,41,41,41,41,77,42,42,42,42,78,43,43,43,43,79,44,44,44,44,80,45,45,45,45,
+        76,76,76,76,76,76,76,76,76,41,41,77,77,77,77,42,78,78,78,43,79,79,79,79,44,80,80,80,80,45,81,81,
+        76,76,76,76,76,76,76,76,76,76,77,77,77,77,77,77,78,78,78,78,79,79,79,79,79,80,80,80,80,80,81,81,
+        76,76,76,76,76,76,76,76,76,76,76,77,77,77,77,77,78,78,78,78,78,79,79,79,79,79,80,80,80,80,81,81,
+        46,46,46,46,46,47,47,47,47,47,47,47,47,48,48,48,48,48,49,49,49,49,49,50,50,50,50,50,51,51,51,51,
+        46,46,46,46,82,82,10,10,47,47,47,47,47,48,48,48,48,84,49,49,49,49,85,50,50,50,50,86,51,51,51,14,
+        82,82,82,82,82,82,82,82,10,10,10,10,83,83,83,48,84,84,84,84,49,85,85,85,50,86,86,86,86,14,14,14,
+        52,52,52,52,52,52,52,53,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,53,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,53,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,53,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,236,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,57,57,57,57,
+        52,52,52,52,237,237,237,237,237,237,53,53,53,53,54,54,54,54,54,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        237,237,237,237,237,237,237,237,237,237,238,238,53,53,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        237,237,237,237,238,238,238,238,238,238,238,238,238,238,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        238,238,238,238,238,238,238,238,238,238,238,239,239,239,239,60,60,60,61,61,61,61,61,56,56,56,62,12,12,12,12,12,
+        58,58,58,239,239,239,239,239,239,239,239,239,239,239,60,60,60,60,61,61,61,61,61,61,62,62,62,62,12,12,12,12,
+        58,58,58,58,58,58,239,239,239,8,8,8,8,8,60,60,60,60,60,61,61,61,61,61,62,62,62,62,12,12,12,12,
+        58,58,58,58,58,58,58,8,8,240,240,240,240,240,60,60,60,60,60,61,61,61,61,61,62,62,62,62,62,12,12,12,
+        58,58,58,58,58,58,58,58,58,59,59,59,59,59,241,60,60,60,60,60,61,61,61,61,62,62,62,62,62,63,63,63,
+        58,58,58,58,58,58,58,58,58,241,241,241,241,241,241,242,60,60,60,60,61,61,61,61,61,62,62,62,62,63,63,63,
+        58,58,58,58,58,58,58,58,58,65,65,242,242,242,242,242,242,242,60,60,67,61,61,61,61,62,62,62,62,63,63,63,
+        64,64,64,64,64,64,64,65,65,65,65,65,65,65,66,66,66,66,66,67,67,67,67,67,68,68,68,68,68,69,69,69,
+        64,64,64,64,64,64,64,64,65,65,65,65,65,65,66,66,66,66,66,67,67,67,67,67,68,68,68,68,68,69,69,69,
+        64,64,64,64,64,64,64,64,64,65,65,65,65,65,65,66,66,66,66,66,67,67,67,67,67,68,68,68,68,69,69,69,
+        64,64,64,64,64,64,64,64,64,64,65,65,65,65,65,65,66,66,66,66,67,67,67,67,67,68,68,68,68,68,69,69,
+        2,2,2,2,2,2,64,35,35,35,71,71,71,36,36,72,72,6,6,6,6,6,6,67,38,74,74,68,68,39,75,75,
+        70,70,70,70,70,70,70,35,35,71,71,71,71,71,72,72,72,72,6,6,6,73,73,73,74,74,74,74,74,75,75,75,
+        70,70,70,70,70,70,70,70,70,71,71,71,71,71,71,72,72,72,72,73,73,73,73,73,74,74,74,74,74,75,75,75,
+        70,70,70,70,70,70,70,70,70,71,71,71,71,71,71,72,72,72,72,72,73,73,73,73,73,74,74,74,74,75,75,75,
+        70,70,70,70,70,70,70,70,70,70,71,71,71,71,71,71,72,72,72,72,72,73,73,73,73,74,74,74,74,74,75,75,
+        76,76,76,76,76,41,41,41,41,41,41,41,42,42,42,42,42,78,43,43,43,43,79,44,44,44,44,80,45,45,45,45,
+        76,76,76,76,76,76,76,41,41,41,77,77,77,77,42,78,78,78,78,43,79,79,79,79,44,80,80,80,45,45,81,81,
+        76,76,76,76,76,76,76,76,76,77,77,77,77,77,77,78,78,78,78,79,79,79,79,79,80,80,80,80,80,81,81,81,
+        76,76,76,76,76,76,76,76,76,76,77,77,77,77,77,78,78,78,78,78,79,79,79,79,79,80,80,80,80,80,81,81,
+        76,76,76,76,76,76,76,76,76,76,76,77,77,77,77,77,78,78,78,78,78,79,79,79,79,79,80,80,80,80,81,81,
+        46,46,46,46,47,47,47,47,47,47,47,47,48,48,48,48,48,84,49,49,49,49,85,50,50,50,50,86,51,51,51,14,
+        82,82,82,82,82,82,10,10,10,10,10,10,83,83,48,48,84,84,84,49,49,85,85,85,50,50,86,86,51,14,14,14,
+        82,82,82,82,82,82,82,82,10,10,10,10,83,83,83,84,84,84,84,84,85,85,85,85,86,86,86,86,86,14,14,14,
+        52,52,52,52,52,52,52,53,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,53,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,53,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,52,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,52,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,237,237,237,53,53,53,53,53,54,54,54,54,54,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        237,237,237,237,237,237,237,238,238,238,238,53,53,53,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        238,238,238,238,238,238,238,238,238,238,238,238,238,239,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        238,238,238,238,238,238,238,238,239,239,239,239,239,239,60,60,60,60,61,61,61,61,61,62,62,62,62,12,12,12,12,12,
+        58,58,58,58,239,239,239,239,239,239,239,239,239,8,60,60,60,60,61,61,61,61,61,61,62,62,62,62,12,12,12,12,
+        58,58,58,58,58,58,8,8,8,8,8,8,8,240,60,60,60,60,60,61,61,61,61,61,62,62,62,62,62,12,12,12,
+        58,58,58,58,58,58,58,240,240,240,240,240,240,59,60,60,60,60,60,61,61,61,61,61,62,62,62,62,62,63,63,63,
+        58,58,58,58,58,58,58,58,59,59,59,59,241,241,241,60,60,60,60,60,61,61,61,61,62,62,62,62,62,63,63,63,
+        58,58,58,58,58,58,58,58,58,241,241,241,241,242,242,242,60,60,60,60,61,61,61,61,62,62,62,62,62,63,63,63,
+        64,58,58,58,58,58,58,58,65,65,242,242,242,242,242,242,242,242,60,67,67,61,61,61,68,68,62,62,62,63,63,63,
+        64,64,64,64,64,64,64,65,65,65,65,65,65,65,66,66,66,66,66,67,67,67,67,67,68,68,68,68,68,69,69,69,
+        64,64,64,64,64,64,64,64,65,65,65,65,65,65,66,66,66,66,66,67,67,67,67,67,68,68,68,68,68,69,69,69,
+        64,64,64,64,64,64,64,64,64,65,65,65,65,65,65,66,66,66,66,66,67,67,67,67,68,68,68,68,68,69,69,69,
+        64,64,64,64,64,64,64,64,64,64,65,65,65,65,65,65,66,66,66,66,67,67,67,67,67,68,68,68,68,68,69,69,
+        70,70,70,70,70,64,64,71,71,71,71,71,71,72,72,72,72,6,6,6,6,73,73,74,74,74,74,68,75,75,75,75,
+        70,70,70,70,70,70,70,71,71,71,71,71,71,71,72,72,72,72,72,73,73,73,73,73,74,74,74,74,75,75,75,75,
+        70,70,70,70,70,70,70,70,71,71,71,71,71,71,72,72,72,72,72,73,73,73,73,73,74,74,74,74,74,75,75,75,
+        70,70,70,70,70,70,70,70,70,71,71,71,71,71,71,72,72,72,72,72,73,73,73,73,73,74,74,74,74,75,75,75,
+        70,70,70,70,70,70,70,70,70,70,71,71,71,71,71,71,72,72,72,72,72,73,73,73,73,74,74,74,74,74,75,75,
+        76,76,76,76,76,76,41,41,41,77,77,77,77,42,78,78,78,78,43,79,79,79,79,44,80,80,80,80,45,81,81,81,
+        76,76,76,76,76,76,76,76,77,77,77,77,77,77,78,78,78,78,78,79,79,79,79,79,80,80,80,80,81,81,81,81,
+        76,76,76,76,76,76,76,76,76,77,77,77,77,77,77,78,78,78,78,79,79,79,79,79,80,80,80,80,80,81,81,81,
+        76,76,76,76,76,76,76,76,76,77,77,77,77,77,77,78,78,78,78,78,79,79,79,79,79,80,80,80,80,80,81,81,
+        76,76,76,76,76,76,76,76,76,76,77,77,77,77,77,77,78,78,78,78,78,79,79,79,79,80,80,80,80,80,81,81,
+        82,82,82,82,10,10,10,10,10,10,10,83,83,48,48,84,84,84,49,49,85,85,85,50,50,86,86,86,51,14,14,14,
+        82,82,82,82,82,82,10,10,10,10,10,83,83,83,84,84,84,84,84,85,85,85,85,85,86,86,86,86,14,14,14,14,
+        82,82,82,82,82,82,82,82,10,10,10,83,83,83,83,84,84,84,84,85,85,85,85,85,86,86,86,86,86,14,14,87,
+        52,52,52,52,52,52,52,53,53,53,53,53,53,53,53,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,53,53,53,53,53,53,53,53,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,53,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,52,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,52,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,52,238,53,53,53,53,53,54,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        238,238,238,238,238,238,238,238,238,238,238,53,53,53,54,54,54,54,54,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        238,238,238,238,238,238,238,238,238,238,238,239,239,239,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        58,239,239,239,239,239,239,239,239,239,239,239,239,239,60,60,60,60,61,61,61,61,61,62,62,62,62,62,12,12,12,12,
+        58,58,58,58,239,239,239,239,239,239,8,8,8,8,60,60,60,60,61,61,61,61,61,61,62,62,62,62,12,12,12,12,
+        58,58,58,58,58,58,8,8,8,8,240,240,240,240,60,60,60,60,60,61,61,61,61,61,62,62,62,62,62,12,12,12,
+        58,58,58,58,58,58,58,240,240,240,59,59,59,59,60,60,60,60,60,61,61,61,61,61,62,62,62,62,62,63,63,63,
+        58,58,58,58,58,58,58,58,59,241,241,241,241,241,241,60,60,60,60,61,61,61,61,61,62,62,62,62,62,63,63,63,
+        58,58,58,58,58,58,58,58,58,241,241,242,242,242,242,242,60,60,60,60,61,61,61,61,62,62,62,62,62,63,63,63,
+        64,64,58,58,58,58,58,65,65,65,242,242,242,242,242,242,242,243,243,67,67,67,61,61,68,68,62,62,62,69,69,63,
+        64,64,64,64,64,64,64,65,65,65,65,65,65,243,243,243,243,66,67,67,67,67,67,67,68,68,68,68,68,69,69,69,
+        64,64,64,64,64,64,64,64,65,65,65,65,65,65,66,66,66,66,66,67,67,67,67,67,68,68,68,68,68,69,69,69,
+        64,64,64,64,64,64,64,64,64,65,65,65,65,65,65,66,66,66,66,66,67,67,67,67,68,68,68,68,68,69,69,69,
+        64,64,64,64,64,64,64,64,64,65,65,65,65,65,65,65,66,66,66,66,67,67,67,67,67,68,68,68,68,69,69,69,
+        70,70,70,70,70,70,71,71,71,71,71,71,71,72,72,72,72,72,73,73,73,73,73,74,74,74,74,74,75,75,75,75,
+        70,70,70,70,70,70,70,71,71,71,71,71,71,71,72,72,72,72,72,73,73,73,73,74,74,74,74,74,75,75,75,75,
+        70,70,70,70,70,70,70,70,71,71,71,71,71,71,72,72,72,72,72,73,73,73,73,73,74,74,74,74,74,75,75,75,
+        70,70,70,70,70,70,70,70,70,71,71,71,71,71,71,72,72,72,72,72,73,73,73,73,73,74,74,74,74,75,75,75,
+        70,70,70,70,70,70,70,70,70,70,71,71,71,71,71,71,72,72,72,72,73,73,73,73,73,74,74,74,74,74,75,75,
+        76,76,76,76,76,76,77,77,77,77,77,77,77,78,78,78,78,78,79,79,79,79,79,80,80,80,80,80,81,81,81,81,
+        76,76,76,76,76,76,76,77,77,77,77,77,77,77,78,78,78,78,78,79,79,79,79,80,80,80,80,80,81,81,81,81,
+        76,76,76,76,76,76,76,76,77,77,77,77,77,77,78,78,78,78,78,79,79,79,79,79,80,80,80,80,80,81,81,81,
+        76,76,76,76,76,76,76,76,76,77,77,77,77,77,77,78,78,78,78,78,79,79,79,79,79,80,80,80,80,80,81,81,
+        76,76,76,76,76,76,76,76,112,112,112,77,77,77,77,113,78,78,78,78,114,79,79,79,79,80,80,80,80,80,81,81,
+        82,82,82,82,10,10,10,10,10,10,83,83,83,84,84,84,84,84,85,85,85,85,85,86,86,86,86,86,14,14,14,14,
+        82,82,82,82,82,82,10,10,10,10,83,83,83,83,84,84,84,84,84,85,85,85,85,85,86,86,86,86,14,14,14,87,
+        82,82,82,82,82,82,82,82,10,10,10,83,83,83,83,84,84,84,84,85,85,85,85,85,86,86,86,86,86,87,87,87,
+        52,52,52,52,52,52,52,53,53,53,53,53,53,53,53,54,54,54,54,54,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,53,53,53,53,53,53,53,53,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,52,53,53,53,53,53,53,53,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,52,52,52,53,53,53,53,53,53,53,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        52,52,52,52,52,88,88,88,89,89,53,53,53,53,53,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,53,53,54,54,54,54,55,55,55,55,55,56,56,56,56,56,57,57,57,
+        88,88,88,88,88,88,88,238,238,238,89,89,89,89,89,90,90,54,54,55,55,55,55,56,56,56,56,56,57,57,57,57,
+        238,238,238,238,238,238,239,239,239,239,239,239,89,89,89,90,90,90,90,55,55,55,55,56,56,56,56,56,57,57,57,12,
+        58,58,239,239,239,239,239,239,239,239,239,239,8,60,60,60,60,60,61,61,61,61,61,62,62,62,62,62,12,12,12,12,
+        58,58,58,58,8,8,8,8,8,8,8,8,8,60,60,60,60,60,61,61,61,61,61,61,62,62,62,62,62,12,12,12,
+        58,58,58,58,58,58,240,240,240,240,240,240,240,59,60,60,60,60,60,61,61,61,61,61,62,62,62,62,62,63,63,63,
+        58,58,58,58,58,58,58,59,59,59,59,59,59,241,60,60,60,60,60,61,61,61,61,61,62,62,62,62,62,63,63,63,
+        58,58,58,58,58,58,58,58,241,241,241,241,241,241,241,60,60,60,60,61,61,61,61,61,62,62,62,62,62,63,63,63,
+        58,58,58,58,58,58,58,58,94,242,242,242,242,242,242,242,242,60,60,60,61,61,61,61,62,62,62,62,62,63,63,63,
+        64,64,64,64,58,58,94,65,65,65,242,242,242,242,243,243,243,243,243,67,67,67,61,68,68,68,68,62,62,69,69,69,
+        64,64,64,64,64,64,64,65,65,65,65,65,65,243,243,243,243,243,243,67,67,67,67,68,68,68,68,68,68,69,69,69,
+        64,64,64,64,64,64,64,65,65,65,65,65,65,65,66,66,66,66,66,67,67,67,67,67,68,68,68,68,68,69,69,69,
+        64,64,64,64,64,64,64,64,65,65,65,65,65,65,65,66,66,66,66,66,67,67,67,67,68,68,68,68,68,69,69,69,
+        64,64,64,64,64,64,64,100,100,100,65,65,65,65,65,66,66,66,66,245,67,67,67,67,67,68,68,68,68,69,69,69,
+        70,70,70,70,70,70,71,71,71,71,71,71,71,72,72,72,72,72,73,73,73,73,73,74,74,74,74,74,75,75,75,75,
+        70,70,70,70,70,70,70,71,71,71,71,71,71,72,72,72,72,72,73,73,73,73,73,74,74,74,74,74,75,75,75,75,
+        70,70,70,70,70,70,70,70,71,71,71,71,71,71,72,72,72,72,72,73,73,73,73,73,74,74,74,74,74,75,75,75,
+        70,70,70,70,70,70,70,70,106,71,71,71,71,71,71,72,72,72,72,72,73,73,73,73,74,74,74,74,74,75,75,75,
+        70,70,70,70,70,106,106,106,106,106,71,71,71,71,107,107,72,72,108,108,108,73,73,109,109,74,74,74,110,110,75,75,
+        76,76,76,76,76,76,77,77,77,77,77,77,77,78,78,78,78,78,79,79,79,79,79,80,80,80,80,80,81,81,81,81,
+        76,76,76,76,76,76,76,77,77,77,77,77,77,77,78,78,78,78,79,79,79,79,79,80,80,80,80,80,81,81,81,81,
+        76,76,76,76,76,76,76,76,77,77,77,77,77,77,78,78,78,78,78,79,79,79,79,79,80,80,80,80,80,81,81,81,
+        76,76,76,76,76,76,76,112,112,77,77,77,77,77,113,78,78,78,78,114,79,79,79,79,115,80,80,80,80,81,81,81,
+        76,76,112,112,112,112,112,112,112,112,112,77,113,113,113,113,113,114,114,114,114,79,115,115,115,115,80,116,116,116,81,81,
+        82,82,82,10,10,10,10,10,10,83,83,83,83,84,84,84,84,84,85,85,85,85,85,86,86,86,86,86,14,14,87,87,
+        82,82,82,82,82,82,10,10,10,10,83,83,83,83,84,84,84,84,84,85,85,85,85,86,86,86,86,86,14,87,87,87,
+        82,82,82,82,82,82,82,10,10,10,83,83,83,83,84,84,84,84,84,85,85,85,85,85,86,86,86,86,86,87,87,87,
+        88,88,88,88,88,88,88,89,89,89,89,89,53,53,90,90,90,54,54,91,91,91,55,55,92,92,92,56,56,93,93,57,
+        88,88,88,88,88,88,88,89,89,89,89,89,89,89,90,90,90,90,54,91,91,91,91,55,92,92,92,56,56,93,93,93,
+        88,88,88,88,88,88,88,89,89,89,89,89,89,89,90,90,90,90,90,91,91,91,91,55,92,92,92,92,56,93,93,93,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,89,90,90,90,90,90,91,91,91,91,91,92,92,92,92,56,93,93,93,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,89,90,90,90,90,90,91,91,91,91,91,92,92,92,92,93,93,93,93,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,89,89,90,90,90,90,91,91,91,91,91,92,92,92,92,93,93,93,93,
+        88,88,88,88,88,88,88,88,88,89,89,89,89,89,89,90,90,90,90,91,91,91,91,92,92,92,92,92,93,93,93,93,
+        88,88,88,88,88,88,88,239,239,239,239,89,89,89,89,90,90,90,90,91,91,91,91,92,92,92,92,92,93,93,93,93,
+        58,58,239,239,239,239,239,239,8,8,8,8,8,60,60,60,60,60,61,61,61,61,61,62,62,62,62,62,62,12,12,12,
+        58,58,58,58,94,8,8,8,8,240,240,240,240,60,60,60,60,60,61,61,61,61,61,61,62,62,62,62,62,63,63,63,
+        58,58,58,94,94,94,240,240,240,240,59,59,59,60,60,60,60,60,60,61,61,61,61,61,62,62,62,62,62,63,63,63,
+        58,58,58,94,94,94,94,94,59,59,241,241,241,241,60,60,60,60,60,61,61,61,61,61,62,62,62,62,62,63,63,63,
+        94,94,94,94,94,94,94,94,241,241,241,241,242,242,242,60,96,96,96,96,97,97,97,97,98,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,94,94,94,242,242,242,242,242,242,242,242,96,96,96,97,97,97,97,97,98,98,98,98,99,99,99,
+        64,94,94,94,94,94,94,94,65,65,242,243,243,243,243,243,243,243,243,67,67,67,97,97,68,68,98,98,98,69,69,99,
+        64,64,64,64,64,100,65,65,65,65,65,65,243,243,243,243,243,244,244,67,67,67,67,68,68,68,68,68,68,69,69,69,
+        64,64,64,100,100,100,100,100,65,65,65,65,65,101,244,244,244,244,244,67,67,67,67,67,68,68,68,68,68,69,69,69,
+        100,100,100,100,100,100,100,100,100,65,65,65,101,101,101,66,66,102,102,102,67,103,103,103,103,68,104,104,104,69,69,105,
+        100,100,100,100,100,100,100,100,100,100,101,101,101,101,101,101,245,245,245,245,245,103,103,103,103,104,104,104,104,104,105,105,
+        70,70,70,70,70,71,71,71,71,71,71,71,71,72,72,72,72,246,246,246,246,246,246,74,74,74,74,74,75,75,75,75,
+        70,70,70,70,70,70,71,71,71,71,71,71,71,72,72,72,72,72,73,73,73,73,73,74,74,74,74,74,75,75,75,75,
+        70,70,70,70,106,106,106,106,71,71,71,71,71,107,72,72,72,72,108,73,73,73,73,109,74,74,74,74,110,75,75,75,
+        106,106,106,106,106,106,106,106,106,71,71,71,107,107,107,72,108,108,108,108,73,109,109,109,109,74,110,110,110,110,111,111,
+        106,106,106,106,106,106,106,106,106,106,106,107,107,107,107,107,108,108,108,108,108,109,109,109,109,110,110,110,110,110,111,111,
+        76,76,76,76,76,77,77,77,77,77,77,77,77,78,78,78,78,78,79,79,79,79,79,80,80,80,80,80,81,81,81,81,
+        76,76,76,76,76,76,77,77,77,77,77,77,77,78,78,78,78,78,79,79,79,79,79,80,80,80,80,80,81,81,81,81,
+        76,76,76,76,112,112,112,112,77,77,77,77,77,113,78,78,78,78,114,79,79,79,79,115,80,80,80,80,116,81,81,81,
+        112,112,112,112,112,112,112,112,112,112,77,113,113,113,113,113,114,114,114,114,79,115,115,115,115,80,116,116,116,116,117,117,
+        112,112,112,112,112,112,112,112,112,112,112,113,113,113,113,113,114,114,114,114,114,115,115,115,115,115,116,116,116,116,117,117,
+        82,82,82,10,10,10,10,10,83,83,83,83,83,84,84,84,84,84,85,85,85,85,85,86,86,86,86,86,87,87,87,87,
+        82,82,82,82,82,10,10,10,10,83,83,83,83,84,84,84,84,84,85,85,85,85,85,86,86,86,86,86,87,87,87,87,
+        82,82,82,82,118,118,118,118,10,83,83,83,83,119,119,84,84,120,120,85,85,85,121,121,86,86,86,122,122,87,87,87,
+        88,88,88,88,88,88,88,89,89,89,89,89,89,89,90,90,90,90,90,91,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,89,89,89,89,89,89,89,90,90,90,90,90,91,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,89,90,90,90,90,90,91,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,89,90,90,90,90,90,91,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,89,89,90,90,90,90,91,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,88,88,89,89,89,89,89,89,90,90,90,90,91,91,91,91,91,92,92,92,92,93,93,93,93,
+        88,88,88,88,88,88,88,88,88,89,89,89,89,89,89,90,90,90,90,91,91,91,91,91,92,92,92,92,93,93,93,93,
+        88,88,88,88,88,88,88,88,88,8,89,89,89,89,89,90,90,90,90,91,91,91,91,92,92,92,92,92,93,93,93,93,
+        94,94,94,94,94,8,8,8,8,8,95,95,95,96,96,96,96,96,97,97,97,97,97,98,98,92,98,98,93,93,93,93,
+        94,94,94,94,94,94,240,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,97,98,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,94,95,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,98,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,94,94,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,98,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,94,94,94,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,98,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,94,94,94,242,242,242,242,242,242,243,96,96,96,96,97,97,97,97,97,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,94,94,94,101,243,243,243,243,243,243,243,243,243,96,103,97,97,97,97,98,98,98,98,99,99,99,
+        100,100,100,100,100,100,100,65,101,101,101,101,243,243,243,244,244,244,244,103,103,103,103,103,104,104,104,104,104,105,105,105,
+        100,100,100,100,100,100,100,100,101,101,101,101,101,101,244,244,244,244,244,103,103,103,103,103,104,104,104,104,104,105,105,105,
+        100,100,100,100,100,100,100,100,100,101,101,101,101,101,101,102,102,102,245,245,103,103,103,103,103,104,104,104,104,105,105,105,
+        100,100,100,100,100,100,100,100,100,100,101,101,101,101,101,101,245,245,245,246,246,103,103,103,103,104,104,104,104,104,105,105,
+        106,106,106,106,100,100,100,71,71,71,71,107,107,72,72,72,246,246,246,246,246,246,246,103,74,74,110,104,104,75,75,111,
+        106,106,106,106,106,106,106,71,71,71,107,107,107,107,72,108,108,108,108,73,109,109,109,109,110,110,110,110,110,111,111,111,
+        106,106,106,106,106,106,106,106,106,107,107,107,107,107,107,108,108,108,108,109,109,109,109,109,110,110,110,110,110,111,111,111,
+        106,106,106,106,106,106,106,106,106,106,107,107,107,107,107,108,108,108,108,108,109,109,109,109,109,110,110,110,110,110,111,111,
+        106,106,106,106,106,106,106,106,106,106,107,107,107,107,107,107,108,108,108,108,108,109,109,109,109,110,110,110,110,110,111,111,
+        76,76,112,112,112,77,77,77,77,77,77,77,78,78,78,78,78,114,79,79,79,79,115,80,80,80,80,116,81,81,81,81,
+        112,112,112,112,112,112,112,77,77,77,77,113,113,113,78,78,114,114,114,79,79,115,115,80,80,80,116,116,81,81,117,117,
+        112,112,112,112,112,112,112,112,112,113,113,113,113,113,113,114,114,114,114,114,115,115,115,115,116,116,116,116,116,117,117,117,
+        112,112,112,112,112,112,112,112,112,112,113,113,113,113,113,113,114,114,114,114,115,115,115,115,115,116,116,116,116,116,117,117,
+        112,112,112,112,112,112,112,112,112,112,112,113,113,113,113,113,114,114,114,114,114,115,115,115,115,115,116,116,116,116,117,117,
+        82,82,10,10,10,10,10,83,83,83,83,83,84,84,84,84,84,84,85,85,85,85,85,86,86,86,86,86,87,87,87,87,
+        118,118,118,118,118,118,118,10,83,83,83,119,119,119,84,84,120,120,120,85,85,121,121,86,86,86,122,122,87,87,87,123,
+        118,118,118,118,118,118,118,118,118,119,119,119,119,119,119,120,120,120,120,120,121,121,121,121,122,122,122,122,122,123,123,123,
+        88,88,88,88,88,88,88,89,89,89,89,89,89,89,90,90,90,90,90,91,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,89,90,90,90,90,90,91,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,89,89,90,90,90,90,91,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,89,89,90,90,90,90,91,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,89,89,90,90,90,90,91,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,88,88,89,89,89,89,89,89,90,90,90,90,91,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,88,88,89,89,89,89,89,89,90,90,90,90,91,91,91,91,91,92,92,92,92,93,93,93,93,
+        88,88,88,88,88,88,88,88,88,95,89,89,89,89,89,90,90,90,90,91,91,91,91,91,92,92,92,92,93,93,93,93,
+        94,94,94,94,94,95,95,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,98,98,98,98,98,93,93,93,99,
+        94,94,94,94,94,94,95,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,97,98,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,94,95,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,98,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,94,94,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,98,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,94,94,95,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,98,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,94,94,94,95,95,95,95,95,243,243,96,96,96,96,97,97,97,97,97,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,94,94,101,101,243,243,243,243,243,243,243,243,96,96,103,97,97,97,104,104,98,98,98,105,99,99,
+        100,100,100,100,100,100,100,101,101,101,101,101,101,244,244,244,244,244,244,103,103,103,103,103,104,104,104,104,104,105,105,105,
+        100,100,100,100,100,100,100,100,101,101,101,101,101,101,244,244,102,102,102,103,103,103,103,103,104,104,104,104,104,105,105,105,
+        100,100,100,100,100,100,100,100,100,101,101,101,101,101,101,102,245,245,245,245,103,103,103,103,104,104,104,104,104,105,105,105,
+        100,100,100,100,100,100,100,100,100,100,101,101,101,101,101,245,245,246,246,246,246,103,103,103,103,104,104,104,104,104,105,105,
+        106,106,106,106,106,100,100,107,107,107,107,107,107,108,108,108,246,246,246,246,246,246,247,110,110,110,110,104,111,111,111,111,
+        106,106,106,106,106,106,106,107,107,107,107,107,107,107,108,108,108,108,108,109,109,109,109,110,110,110,110,110,111,111,111,111,
+        106,106,106,106,106,106,106,106,107,107,107,107,107,107,108,108,108,108,108,109,109,109,109,109,110,110,110,110,110,111,111,111,
+        106,106,106,106,106,106,106,106,106,107,107,107,107,107,107,108,108,108,108,108,109,109,109,109,109,110,110,110,110,111,111,111,
+        106,106,106,106,106,106,106,106,106,106,107,107,107,107,107,107,108,108,108,108,108,109,109,109,109,110,110,110,110,110,111,111,
+        112,112,112,112,112,112,77,113,113,113,113,113,113,114,114,114,114,114,115,115,115,115,115,116,116,116,116,116,117,117,117,117,
+        112,112,112,112,112,112,112,113,113,113,113,113,113,113,114,114,114,114,114,115,115,115,115,115,116,116,116,116,117,117,117,117,
+        112,112,112,112,112,112,112,112,112,113,113,113,113,113,113,114,114,114,114,115,115,115,115,115,116,116,116,116,116,117,117,117,
+        112,112,112,112,112,112,112,112,112,112,113,113,113,113,113,114,114,114,114,114,115,115,115,115,115,116,116,116,116,116,117,117,
+        112,112,112,112,112,112,112,112,112,112,112,113,113,113,113,113,114,114,114,114,114,115,115,115,115,116,116,116,116,116,117,117,
+        118,118,118,118,118,83,83,83,83,119,119,119,119,84,84,120,120,120,85,85,121,121,121,86,122,122,122,122,87,123,123,123,
+        118,118,118,118,118,118,118,118,119,119,119,119,119,119,120,120,120,120,120,121,121,121,121,121,122,122,122,122,123,123,123,123,
+        118,118,118,118,118,118,118,118,118,119,119,119,119,119,119,120,120,120,120,120,121,121,121,121,122,122,122,122,122,123,123,123,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,89,89,90,90,90,90,91,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,89,89,90,90,90,90,91,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,89,89,90,90,90,90,91,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,89,89,90,90,90,90,91,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,89,89,90,90,90,90,91,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,88,88,89,89,89,89,89,89,90,90,90,90,91,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,88,88,89,89,89,89,89,89,90,90,90,90,91,91,91,91,91,92,92,92,92,92,93,93,93,
+        1,1,1,1,1,1,1,1,1,95,125,89,89,89,89,90,90,90,90,91,91,91,91,91,92,92,92,92,93,93,93,93,
+        94,94,94,94,3,95,95,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,98,98,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,95,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,97,98,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,94,95,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,98,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,94,95,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,98,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,94,94,95,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,98,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,94,94,94,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,98,98,98,98,99,99,99,
+        100,100,94,94,94,94,94,101,101,101,101,243,243,243,243,243,244,244,96,103,103,103,97,97,104,104,98,98,98,105,105,99,
+        100,100,100,100,100,100,100,101,101,101,101,101,101,244,244,244,244,244,244,103,103,103,103,103,104,104,104,104,104,105,105,105,
+        100,100,100,100,100,100,100,100,101,101,101,101,101,101,102,102,102,102,102,103,103,103,103,103,104,104,104,104,104,105,105,105,
+        100,100,100,100,100,100,100,100,100,101,101,101,101,101,101,245,245,245,245,245,103,103,103,103,104,104,104,104,104,105,105,105,
+        100,100,100,100,100,100,100,100,100,101,101,101,101,101,101,246,246,246,246,246,246,246,103,103,103,104,104,104,104,104,105,105,
+        106,106,106,106,106,106,107,107,107,107,107,107,107,108,108,108,246,246,246,246,247,247,247,247,110,110,110,110,111,111,111,111,
+        106,106,106,106,106,106,106,107,107,107,107,107,107,107,108,108,108,108,247,247,247,109,109,110,110,110,110,110,111,111,111,111,
+        106,106,106,106,106,106,106,106,107,107,107,107,107,107,108,108,108,108,108,109,109,109,109,109,110,110,110,110,110,111,111,111,
+        106,106,106,106,106,106,106,106,106,107,107,107,107,107,107,108,108,108,108,108,109,109,109,109,109,110,110,110,110,111,111,111,
+        106,106,106,106,106,106,106,106,106,106,107,107,107,107,107,107,108,108,108,108,109,109,109,109,109,110,110,110,110,110,111,111,
+        112,112,112,112,112,112,113,113,113,113,113,113,113,114,114,114,114,114,115,115,115,115,115,116,116,116,116,116,117,117,117,117,
+        112,112,112,112,112,112,112,113,113,113,113,113,113,113,114,114,114,114,114,115,115,115,115,116,116,116,116,116,117,117,117,117,
+        112,112,112,112,112,112,112,112,113,113,113,113,113,113,114,114,114,114,114,115,115,115,115,115,116,116,116,116,116,117,117,117,
+        112,112,112,112,112,112,112,112,112,113,113,113,113,113,113,114,114,114,114,114,115,115,115,115,115,116,116,116,116,116,117,117,
+        112,112,112,112,112,112,112,112,112,112,113,113,113,113,113,113,114,114,114,114,114,115,115,115,115,116,116,116,116,116,117,117,
+        118,118,118,118,118,119,119,119,119,119,119,119,119,120,120,120,120,120,121,121,121,121,121,122,122,122,122,122,123,123,123,123,
+        118,118,118,118,118,118,118,119,119,119,119,119,119,119,120,120,120,120,120,121,121,121,121,121,122,122,122,122,123,123,123,123,
+        118,118,118,118,118,118,118,118,119,119,119,119,119,119,119,120,120,120,120,121,121,121,121,121,122,122,122,122,122,123,123,123,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,89,89,90,90,90,90,90,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,89,89,90,90,90,90,90,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,88,89,89,89,89,89,89,89,90,90,90,90,90,91,91,91,91,92,92,92,92,92,93,93,93,
+        88,88,88,88,88,88,88,1,89,89,89,89,89,89,89,90,90,90,90,90,91,91,91,91,92,92,92,92,92,93,93,93,
+        1,1,1,1,1,1,1,1,1,125,89,89,89,89,89,90,90,90,90,5,91,91,91,91,92,92,92,92,92,93,93,93,
+        1,1,1,1,1,1,1,1,1,125,125,125,125,89,89,126,90,90,90,5,5,91,91,91,92,92,92,92,92,93,93,93,
+        1,1,1,1,1,1,1,1,1,125,125,125,125,125,125,126,126,126,126,5,5,5,91,91,92,92,92,92,92,93,93,93,
+        1,1,1,1,1,1,1,1,1,1,125,125,125,125,125,126,126,126,126,5,5,5,5,5,92,92,92,92,92,93,93,93,
+        3,3,3,3,3,3,1,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,98,98,98,98,98,98,99,99,99,
+        3,3,3,3,3,3,3,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,97,98,98,98,98,98,99,99,99,
+        94,94,94,3,3,3,3,95,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,98,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,3,3,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,98,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,94,94,95,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,98,98,98,98,98,99,99,99,
+        94,94,94,94,94,94,94,94,130,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,98,98,98,98,99,99,99,
+        100,100,100,94,94,94,101,101,101,101,101,101,244,244,244,244,244,244,103,103,103,103,97,104,104,104,104,98,98,105,105,105,
+        100,100,100,100,100,100,101,101,101,101,101,101,101,244,244,244,244,102,103,103,103,103,103,104,104,104,104,104,104,105,105,105,
+        100,100,100,100,100,100,100,101,101,101,101,101,101,101,102,102,102,245,245,103,103,103,103,103,104,104,104,104,104,105,105,105,
+        100,100,100,100,100,100,100,100,101,101,101,101,101,101,101,245,245,245,245,246,103,103,103,103,104,104,104,104,104,105,105,105,
+        100,100,100,100,100,100,100,100,136,136,101,101,101,101,101,246,246,246,246,246,246,246,103,103,103,104,104,104,104,104,105,105,
+        106,106,106,106,106,107,107,107,107,107,107,107,107,108,108,246,246,246,247,247,247,247,247,247,110,110,110,110,111,111,111,111,
+        106,106,106,106,106,106,107,107,107,107,107,107,107,108,108,108,108,108,247,247,247,247,247,110,110,110,110,110,111,111,111,111,
+        106,106,106,106,106,106,106,107,107,107,107,107,107,107,108,108,108,108,108,109,109,109,109,109,110,110,110,110,110,111,111,111,
+        106,106,106,106,106,106,106,106,106,107,107,107,107,107,107,108,108,108,108,108,109,109,109,109,110,110,110,110,110,111,111,111,
+        106,106,106,106,106,106,106,142,142,142,107,107,107,107,107,143,108,108,108,108,109,109,109,249,249,110,110,110,110,110,111,111,
+        112,112,112,112,112,113,113,113,113,113,113,113,113,114,114,114,114,114,115,115,115,115,115,116,116,116,116,116,117,117,117,117,
+        112,112,112,112,112,112,113,113,113,113,113,113,113,114,114,114,114,114,115,115,115,115,115,116,116,116,116,116,117,117,117,117,
+        112,112,112,112,112,112,112,112,113,113,113,113,113,113,114,114,114,114,114,115,115,115,115,115,116,116,116,116,116,117,117,117,
+        112,112,112,112,112,112,112,112,148,113,113,113,113,113,113,114,114,114,114,114,115,115,115,115,115,116,116,116,116,117,117,117,
+        112,112,112,112,112,148,148,148,148,148,148,113,113,113,149,149,114,114,150,150,150,115,115,151,151,151,116,116,152,152,117,117,
+        118,118,118,118,118,119,119,119,119,119,119,119,119,120,120,120,120,120,121,121,121,121,121,122,122,122,122,122,123,123,123,123,
+        118,118,118,118,118,118,119,119,119,119,119,119,119,120,120,120,120,120,121,121,121,121,121,122,122,122,122,122,123,123,123,123,
+        118,118,118,118,118,118,118,118,119,119,119,119,119,119,120,120,120,120,120,121,121,121,121,121,122,122,122,122,122,123,123,123,
+        1,1,1,1,1,1,1,1,125,125,125,125,125,125,126,126,126,126,5,5,5,5,5,5,128,128,128,128,128,129,129,129,
+        1,1,1,1,1,1,1,1,125,125,125,125,125,125,126,126,126,126,5,5,5,5,5,5,128,128,128,128,128,129,129,129,
+        1,1,1,1,1,1,1,1,125,125,125,125,125,125,126,126,126,126,5,5,5,5,5,5,128,128,128,128,128,129,129,129,
+        1,1,1,1,1,1,1,1,125,125,125,125,125,125,126,126,126,126,5,5,5,5,5,5,128,128,128,128,128,129,129,129,
+        1,1,1,1,1,1,1,1,125,125,125,125,125,125,125,126,126,126,126,5,5,5,5,5,128,128,128,128,128,129,129,129,
+        1,1,1,1,1,1,1,1,1,125,125,125,125,125,125,126,126,126,126,5,5,5,5,5,128,128,128,128,128,129,129,129,
+        1,1,1,1,1,1,1,1,1,125,125,125,125,125,125,126,126,126,126,5,5,5,5,5,128,128,128,128,129,129,129,129,
+        1,1,1,1,1,1,1,1,1,1,125,125,125,125,125,126,126,126,126,5,5,5,5,127,128,128,128,128,129,129,129,129,
+        3,3,3,3,3,3,3,124,95,95,95,95,125,125,96,96,96,126,126,97,5,5,5,127,128,128,128,128,129,129,129,129,
+        3,3,3,3,3,3,3,3,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,97,98,98,98,98,98,99,99,99,
+        3,3,3,3,3,3,3,3,95,95,95,95,95,95,96,96,96,96,96,97,97,97,97,97,98,98,98,98,98,135,99,99,
+        3,3,3,3,3,3,3,3,3,95,95,131,131,131,132,132,132,132,132,133,133,133,133,97,134,134,134,98,98,135,135,135,
+        130,130,130,130,130,130,130,3,3,131,131,131,131,131,131,132,132,132,132,133,133,133,133,133,134,134,134,134,134,135,135,135,
+        130,130,130,130,130,130,130,130,130,130,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,134,134,134,134,135,135,135,
+        130,130,130,130,130,130,130,130,130,101,101,101,131,244,244,244,244,132,132,132,103,133,133,133,104,104,134,134,134,105,135,135,
+        100,100,136,136,136,136,136,101,101,101,101,101,101,244,102,102,102,102,103,103,103,103,103,104,104,104,104,104,104,105,105,105,
+        136,136,136,136,136,136,136,136,101,101,101,101,137,137,245,245,245,245,138,103,103,103,139,139,104,104,104,140,140,105,105,105,
+        136,136,136,136,136,136,136,136,136,101,137,137,137,137,137,245,246,246,246,246,139,139,139,139,139,140,140,140,140,141,141,141,
+        136,136,136,136,136,136,136,136,136,136,137,137,137,137,137,246,246,246,246,246,246,246,139,139,139,140,140,140,140,140,141,141,
+        106,106,106,106,136,136,107,107,107,107,107,107,108,108,108,247,247,247,247,247,247,247,247,247,110,110,110,140,111,111,111,111,
+        106,106,106,106,142,142,107,107,107,107,107,107,107,108,108,108,108,247,247,247,247,248,248,248,110,110,110,110,111,111,111,111,
+        142,142,142,142,142,142,142,142,107,107,107,107,143,143,108,108,108,144,144,248,248,248,7,7,110,110,110,146,146,111,111,111,
+        142,142,142,142,142,142,142,142,142,142,107,143,143,143,143,143,144,144,144,144,145,145,145,145,249,146,146,146,146,146,147,147,
+        142,142,142,142,142,142,142,142,142,142,142,143,143,143,143,143,144,144,144,144,144,249,249,249,249,250,146,146,146,146,147,147,
+        112,112,112,112,113,113,113,113,113,113,113,113,114,114,114,114,114,115,115,115,115,115,250,250,250,250,250,116,117,117,117,117,
+        112,112,112,112,112,148,113,113,113,113,113,113,113,114,114,114,114,114,115,115,115,115,115,116,116,116,116,116,117,117,117,117,
+        112,148,148,148,148,148,148,148,113,113,113,113,149,149,114,114,114,150,150,115,115,115,151,151,116,116,116,152,152,117,117,117,
+        148,148,148,148,148,148,148,148,148,148,149,149,149,149,149,149,150,150,150,150,151,151,151,151,151,152,152,152,152,152,153,153,
+        148,148,148,148,148,148,148,148,148,148,148,149,149,149,149,149,149,150,150,150,150,151,151,151,151,151,152,152,152,152,153,153,
+        118,118,118,118,119,119,119,119,119,119,119,119,120,120,120,120,120,120,121,121,121,121,121,122,122,122,122,122,123,123,123,123,
+        118,118,118,118,118,118,119,119,119,119,119,119,119,120,120,120,120,120,121,121,121,121,121,122,122,122,122,122,123,123,123,123,
+        154,154,154,154,154,154,154,154,154,119,119,119,155,155,155,120,120,156,156,121,121,121,157,157,122,122,122,158,158,123,123,159,
+        1,1,1,1,1,1,1,1,125,125,125,125,125,125,126,126,126,126,126,5,5,5,5,127,128,128,128,128,128,129,129,129,
+        1,1,1,1,1,1,1,1,125,125,125,125,125,125,126,126,126,126,126,5,5,5,5,127,128,128,128,128,128,129,129,129,
+        1,1,1,1,1,1,1,1,125,125,125,125,125,125,126,126,126,126,126,5,5,5,5,127,128,128,128,128,128,129,129,129,
+        1,1,1,1,1,1,1,1,125,125,125,125,125,125,125,126,126,126,126,5,5,5,5,127,128,128,128,128,128,129,129,129,
+        1,1,1,1,1,1,1,1,125,125,125,125,125,125,125,126,126,126,126,5,5,5,5,127,128,128,128,128,128,129,129,129,
+        1,1,1,1,1,1,1,1,1,125,125,125,125,125,125,126,126,126,126,5,5,5,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,124,124,124,124,125,125,125,125,125,125,126,126,126,126,5,5,5,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,124,124,124,124,124,125,125,125,125,125,126,126,126,126,5,5,5,127,127,128,128,128,128,128,129,129,129,
+        3,3,3,3,3,3,3,3,131,131,131,131,125,125,132,132,132,126,126,133,133,127,127,127,134,128,128,128,129,129,129,129,
+        3,3,3,3,3,3,3,3,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,134,134,134,134,134,134,135,135,135,
+        3,3,3,3,3,3,3,3,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,134,134,134,134,134,135,135,135,
+        3,3,3,3,3,3,3,3,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,134,134,134,134,134,135,135,135,
+        130,130,130,130,130,130,130,130,130,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,134,134,134,134,134,135,135,135,
+        130,130,130,130,130,130,130,130,130,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,134,134,134,134,135,135,135,
+        130,130,130,130,130,130,130,130,130,137,137,131,131,131,131,131,132,132,132,132,139,133,133,133,133,134,134,134,134,135,135,135,
+        136,136,136,136,136,136,136,137,137,137,137,137,137,137,138,138,138,138,138,139,139,139,139,139,140,140,140,140,140,141,141,141,
+        136,136,136,136,136,136,136,136,137,137,137,137,137,137,138,138,138,138,138,139,139,139,139,139,140,140,140,140,140,141,141,141,
+        136,136,136,136,136,136,136,136,136,137,137,137,137,137,137,138,138,138,138,138,139,139,139,139,139,140,140,140,140,141,141,141,
+        136,136,136,136,136,136,136,136,136,136,137,137,137,137,137,246,246,246,246,247,247,139,139,139,139,140,140,140,140,140,141,141,
+        142,142,142,142,136,136,136,136,143,143,143,143,143,137,144,247,247,247,247,247,247,247,247,247,146,146,146,140,140,147,147,147,
+        142,142,142,142,142,142,142,142,143,143,143,143,143,143,144,144,144,144,248,248,248,248,248,248,146,146,146,146,147,147,147,147,
+        142,142,142,142,142,142,142,142,142,143,143,143,143,143,143,144,144,144,144,7,7,7,7,7,146,146,146,146,146,147,147,147,
+        142,142,142,142,142,142,142,142,142,142,143,143,143,143,143,144,144,144,144,144,145,145,249,249,249,146,146,146,146,146,147,147,
+        142,142,142,142,142,142,142,142,142,142,142,143,143,143,143,143,144,144,144,144,144,249,249,250,250,250,146,146,146,146,147,147,
+        148,148,148,148,148,148,113,113,113,149,149,149,149,114,150,150,150,150,115,151,151,250,250,250,250,250,250,250,117,153,153,153,
+        148,148,148,148,148,148,148,148,149,149,149,149,149,149,150,150,150,150,150,151,151,151,151,151,152,152,152,152,152,153,153,153,
+        148,148,148,148,148,148,148,148,148,149,149,149,149,149,149,150,150,150,150,150,151,151,151,151,152,152,152,152,152,153,153,153,
+        148,148,148,148,148,148,148,148,148,148,149,149,149,149,149,149,150,150,150,150,151,151,151,151,151,152,152,152,152,152,153,153,
+        148,148,148,148,148,148,148,148,148,148,148,149,149,149,149,149,150,150,150,150,150,151,151,151,151,151,152,152,152,152,153,153,
+        154,154,154,154,119,119,119,119,119,119,155,155,120,120,120,120,156,156,121,121,157,157,157,122,122,158,158,158,123,123,159,159,
+        154,154,154,154,154,154,154,154,155,155,155,155,155,155,156,156,156,156,156,157,157,157,157,157,158,158,158,158,158,159,159,159,
+        154,154,154,154,154,154,154,154,154,155,155,155,155,155,155,156,156,156,156,156,157,157,157,157,158,158,158,158,158,159,159,159,
+        124,124,124,124,124,124,124,124,125,125,125,125,125,125,126,126,126,126,126,5,5,127,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,124,124,124,125,125,125,125,125,125,125,126,126,126,126,5,5,127,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,124,124,124,125,125,125,125,125,125,125,126,126,126,126,5,5,127,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,124,124,124,125,125,125,125,125,125,125,126,126,126,126,5,5,127,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,124,124,124,124,125,125,125,125,125,125,126,126,126,126,5,5,127,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,124,124,124,124,125,125,125,125,125,125,126,126,126,126,5,5,127,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,124,124,124,124,125,125,125,125,125,125,126,126,126,126,126,127,127,127,127,128,128,128,128,128,129,129,129,
+        3,3,124,124,124,124,124,124,124,124,125,125,125,125,125,125,126,126,126,126,127,127,127,127,128,128,128,128,128,129,129,129,
+        3,3,3,3,3,3,3,3,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,134,134,134,134,134,128,129,129,135,
+        3,3,3,3,3,3,3,3,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,134,134,134,134,134,134,135,135,135,
+        3,3,3,3,3,3,3,3,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,134,134,134,134,134,135,135,135,
+        130,130,130,3,3,3,3,3,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,134,134,134,134,134,135,135,135,
+        130,130,130,130,130,130,130,130,130,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,134,134,134,134,134,135,135,135,
+        130,130,130,130,130,130,130,130,130,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,134,134,134,134,135,135,135,
+        130,130,130,130,130,130,130,130,137,137,137,137,131,131,131,138,138,132,132,132,139,133,133,133,140,140,134,134,134,141,135,135,
+        136,136,136,136,136,136,136,137,137,137,137,137,137,137,138,138,138,138,138,139,139,139,139,139,140,140,140,140,140,141,141,141,
+        136,136,136,136,136,136,136,136,137,137,137,137,137,137,138,138,138,138,138,139,139,139,139,139,140,140,140,140,140,141,141,141,
+        136,136,136,136,136,136,136,136,136,137,137,137,137,137,137,138,138,138,138,138,139,139,139,139,140,140,140,140,140,141,141,141,
+        136,136,136,136,136,136,136,136,136,136,137,137,137,137,137,137,138,138,247,247,247,139,139,139,139,140,140,140,140,140,141,141,
+        142,142,142,142,142,136,136,143,143,143,143,143,143,144,144,144,247,247,247,247,247,247,248,248,146,146,146,140,140,147,147,147,
+        142,142,142,142,142,142,142,143,143,143,143,143,143,143,144,144,144,144,248,248,248,248,248,7,146,146,146,146,147,147,147,147,
+        142,142,142,142,142,142,142,142,143,143,143,143,143,143,144,144,144,144,144,7,7,145,145,145,146,146,146,146,146,147,147,147,
+        142,142,142,142,142,142,142,142,142,143,143,143,143,143,143,144,144,144,144,144,249,249,249,249,249,146,146,146,146,147,147,147,
+        142,142,142,142,142,142,142,142,142,142,143,143,143,143,143,143,144,144,144,144,250,250,250,250,250,250,146,146,146,146,147,147,
+        148,148,148,148,148,148,149,149,149,149,149,149,149,150,150,150,150,150,151,151,151,250,250,250,250,250,251,251,153,153,153,153,
+        148,148,148,148,148,148,148,149,149,149,149,149,149,149,150,150,150,150,150,151,151,151,151,151,152,152,152,152,153,153,153,153,
+        148,148,148,148,148,148,148,148,149,149,149,149,149,149,149,150,150,150,150,151,151,151,151,151,152,152,152,152,152,153,153,153,
+        148,148,148,148,148,148,148,148,148,148,149,149,149,149,149,150,150,150,150,150,151,151,151,151,151,152,152,152,152,152,153,153,
+        148,148,148,148,148,148,148,148,148,148,148,149,149,149,149,149,150,150,150,150,150,151,151,151,151,151,152,152,152,152,153,153,
+        154,154,154,154,154,154,155,155,155,155,155,155,155,156,156,156,156,156,157,157,157,157,157,158,158,158,158,158,159,159,159,159,
+        154,154,154,154,154,154,154,155,155,155,155,155,155,155,156,156,156,156,156,157,157,157,157,157,158,158,158,158,159,159,159,159,
+        154,154,154,154,154,154,154,154,154,155,155,155,155,155,155,156,156,156,156,157,157,157,157,157,158,158,158,158,158,159,159,159,
+        124,124,124,124,124,124,124,124,125,125,125,125,125,125,125,126,126,126,126,127,127,127,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,124,124,124,125,125,125,125,125,125,125,126,126,126,126,127,127,127,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,124,124,124,125,125,125,125,125,125,125,126,126,126,126,126,127,127,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,124,124,124,125,125,125,125,125,125,125,126,126,126,126,126,127,127,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,124,124,124,124,125,125,125,125,125,125,126,126,126,126,126,127,127,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,124,124,124,124,125,125,125,125,125,125,126,126,126,126,126,127,127,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,124,124,124,124,125,125,125,125,125,125,126,126,126,126,126,127,127,127,127,128,128,128,128,128,129,129,129,
+        3,3,3,124,124,124,124,124,124,131,125,125,125,125,125,125,126,126,126,126,127,127,127,127,128,128,128,128,128,129,129,129,
+        3,3,3,3,3,3,3,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,134,134,134,134,134,134,135,135,135,
+        3,3,3,3,3,3,3,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,133,134,134,134,134,134,135,135,135,
+        3,3,3,3,3,3,3,131,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,134,134,134,134,134,135,135,135,
+        130,130,130,130,130,130,130,130,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,134,134,134,134,134,135,135,135,
+        130,130,130,130,130,130,130,130,131,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,134,134,134,134,134,135,135,135,
+        130,130,130,130,130,130,130,130,130,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,134,134,134,134,135,135,135,
+        136,130,130,130,130,130,130,137,137,137,137,137,131,131,138,138,138,132,132,139,139,139,133,133,140,140,140,134,134,141,141,135,
+        136,136,136,136,136,136,136,137,137,137,137,137,137,137,138,138,138,138,139,139,139,139,139,139,140,140,140,140,140,141,141,141,
+        136,136,136,136,136,136,136,136,137,137,137,137,137,137,138,138,138,138,138,139,139,139,139,139,140,140,140,140,140,141,141,141,
+        136,136,136,136,136,136,136,136,136,137,137,137,137,137,137,138,138,138,138,138,139,139,139,139,140,140,140,140,140,141,141,141,
+        136,136,136,136,136,136,136,136,136,136,137,137,137,137,137,137,138,138,138,138,139,139,139,139,139,140,140,140,140,140,141,141,
+        142,142,142,142,142,143,143,143,143,143,143,143,143,144,144,144,247,247,247,248,248,248,248,146,146,146,146,146,147,147,147,147,
+        142,142,142,142,142,142,142,143,143,143,143,143,143,144,144,144,144,144,248,248,248,7,7,146,146,146,146,146,147,147,147,147,
+        142,142,142,142,142,142,142,142,143,143,143,143,143,143,144,144,144,144,144,145,145,145,145,145,146,146,146,146,146,147,147,147,
+        142,142,142,142,142,142,142,142,142,143,143,143,143,143,143,144,144,144,144,144,249,249,249,249,249,146,146,146,146,147,147,147,
+        142,142,142,142,142,142,142,142,142,142,143,143,143,143,143,143,144,144,144,144,250,250,250,250,250,250,250,146,146,146,147,147,
+        148,148,148,148,148,149,149,149,149,149,149,149,149,150,150,150,150,150,151,151,151,250,250,250,251,251,251,251,153,153,153,153,
+        148,148,148,148,148,148,148,149,149,149,149,149,149,149,150,150,150,150,151,151,151,151,151,251,152,152,152,152,153,153,153,153,
+        148,148,148,148,148,148,148,148,149,149,149,149,149,149,150,150,150,150,150,151,151,151,151,151,152,152,152,152,152,153,153,153,
+        148,148,148,148,148,148,148,148,148,149,149,149,149,149,149,150,150,150,150,150,151,151,151,151,151,152,152,152,152,152,153,153,
+        148,148,148,148,148,148,148,148,148,148,149,149,149,149,149,149,150,150,150,150,150,151,151,151,151,152,152,152,152,152,153,153,
+        154,154,154,154,154,155,155,155,155,155,155,155,155,156,156,156,156,156,157,157,157,157,157,158,158,158,158,158,159,159,159,159,
+        154,154,154,154,154,154,154,155,155,155,155,155,155,155,156,156,156,156,156,157,157,157,157,158,158,158,158,158,159,159,159,159,
+        154,154,154,154,154,154,154,154,155,155,155,155,155,155,156,156,156,156,156,157,157,157,157,157,158,158,158,158,158,159,159,159,
+        124,124,124,124,124,124,124,124,125,125,125,125,125,125,125,126,126,126,126,126,127,127,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,124,124,124,125,125,125,125,125,125,125,126,126,126,126,126,127,127,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,124,124,124,125,125,125,125,125,125,125,126,126,126,126,126,127,127,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,124,124,124,125,125,125,125,125,125,125,126,126,126,126,126,127,127,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,124,124,124,124,161,125,125,125,125,125,126,126,126,126,126,127,127,127,127,128,128,128,128,128,129,129,129,
+        124,124,124,124,124,160,160,160,160,161,161,161,125,125,125,162,126,126,126,126,127,127,127,127,128,128,128,128,128,129,129,129,
+        160,160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,126,163,163,127,127,164,128,128,128,128,129,129,129,
+        3,160,160,160,160,160,160,160,160,160,161,161,161,161,161,162,162,162,162,162,163,163,163,163,164,164,164,128,128,129,129,129,
+        3,3,3,3,3,3,160,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,134,134,134,134,134,134,135,135,135,
+        3,3,3,3,3,3,3,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,133,134,134,134,134,134,135,135,135,
+        130,3,3,3,3,3,3,131,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,134,134,134,134,134,135,135,135,
+        130,130,130,130,130,130,130,131,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,134,134,134,134,134,135,135,135,
+        130,130,130,130,130,130,130,130,131,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,134,134,134,134,134,135,135,135,
+        130,130,130,130,130,130,130,130,166,131,131,131,131,131,131,132,132,132,132,132,133,133,133,133,133,134,134,134,134,135,135,135,
+        136,136,136,130,130,166,166,137,137,137,137,137,137,138,138,138,138,138,139,139,139,139,133,133,140,140,140,134,134,141,141,141,
+        136,136,136,136,136,136,137,137,137,137,137,137,137,138,138,138,138,138,139,139,139,139,139,140,140,140,140,140,140,141,141,141,
+        136,136,136,136,136,136,136,137,137,137,137,137,137,137,138,138,138,138,138,139,139,139,139,139,140,140,140,140,140,141,141,141,
+        136,136,136,136,136,136,136,136,137,137,137,137,137,137,137,138,138,138,138,138,139,139,139,139,140,140,140,140,140,141,141,141,
+        136,136,136,136,136,136,136,136,172,172,137,137,137,137,137,138,138,138,138,138,139,139,139,139,139,140,140,140,140,140,141,141,
+        142,142,142,142,142,143,143,143,143,143,143,143,144,144,144,144,144,248,248,248,248,248,248,146,146,146,146,146,147,147,147,147,
+        142,142,142,142,142,142,143,143,143,143,143,143,143,144,144,144,144,144,7,7,7,7,145,146,146,146,146,146,147,147,147,147,
+        142,142,142,142,142,142,142,143,143,143,143,143,143,143,144,144,144,144,144,145,145,249,249,249,146,146,146,146,146,147,147,147,
+        142,142,142,142,142,142,142,142,143,143,143,143,143,143,143,144,144,144,144,249,249,249,250,250,250,146,146,146,146,147,147,147,
+        142,142,142,142,142,142,142,142,178,178,143,143,143,143,143,179,144,144,144,250,250,250,250,250,250,250,250,146,146,146,147,147,
+        148,148,148,148,149,149,149,149,149,149,149,149,150,150,150,150,150,150,151,151,151,251,251,251,251,251,251,251,251,153,153,153,
+        148,148,148,148,148,148,149,149,149,149,149,149,149,150,150,150,150,150,151,151,151,151,151,251,251,251,251,252,153,153,153,153,
+        148,148,148,148,148,148,148,149,149,149,149,149,149,149,150,150,150,150,150,151,151,151,151,151,152,152,152,152,152,153,153,153,
+        148,148,148,148,148,148,148,148,148,149,149,149,149,149,149,150,150,150,150,150,151,151,151,151,151,152,152,152,152,153,153,153,
+        148,148,148,148,148,148,148,184,184,184,184,149,149,149,185,185,150,150,150,186,186,151,151,151,187,187,152,253,253,253,153,153,
+        154,154,154,154,155,155,155,155,155,155,155,155,156,156,156,156,156,156,157,157,157,157,157,158,158,158,158,158,159,159,159,159,
+        154,154,154,154,154,154,155,155,155,155,155,155,155,156,156,156,156,156,157,157,157,157,157,158,158,158,158,158,159,159,159,159,
+        154,154,154,154,154,154,154,154,155,155,155,155,155,155,156,156,156,156,156,157,157,157,157,157,158,158,158,158,158,159,159,159,
+        160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,163,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,163,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,160,161,161,161,161,161,162,162,162,162,162,163,163,163,163,164,164,164,164,164,165,165,165,
+        3,160,160,160,160,160,160,160,160,131,131,161,161,161,161,161,162,162,162,162,163,163,163,163,164,164,164,164,164,165,165,165,
+        3,3,3,3,3,3,131,131,131,131,131,131,131,132,132,132,132,132,132,133,133,133,133,133,170,134,134,134,134,171,171,135,
+        166,166,166,166,166,166,166,131,131,131,131,131,131,167,168,168,132,132,132,169,169,169,133,133,170,170,170,134,134,171,171,171,
+        166,166,166,166,166,166,166,166,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,169,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,166,166,167,167,167,167,167,167,168,168,168,168,169,169,169,169,169,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,166,166,166,167,167,167,167,167,168,168,168,168,168,169,169,169,169,169,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,166,166,166,137,167,167,167,167,167,168,168,168,168,169,169,169,169,169,170,170,170,170,171,171,171,
+        172,172,172,172,172,172,172,137,137,137,137,173,173,173,138,138,174,174,174,139,139,175,175,175,176,176,176,176,177,177,177,177,
+        172,172,172,172,172,172,172,172,137,173,173,173,173,173,173,174,174,174,174,175,175,175,175,175,176,176,176,176,176,177,177,177,
+        172,172,172,172,172,172,172,172,172,173,173,173,173,173,173,174,174,174,174,174,175,175,175,175,175,176,176,176,176,177,177,177,
+        172,172,172,172,172,172,172,172,172,172,173,173,173,173,173,173,174,174,174,174,175,175,175,175,175,176,176,176,176,176,177,177,
+        142,172,172,172,172,172,172,172,143,143,143,143,173,144,144,144,144,248,248,248,248,7,175,175,146,146,146,176,176,147,147,147,
+        178,178,178,178,178,178,178,143,143,143,143,179,179,144,144,144,144,180,7,145,145,145,181,146,146,146,146,182,147,147,147,147,
+        178,178,178,178,178,178,178,178,178,143,179,179,179,179,179,180,180,180,180,249,249,181,181,181,182,182,182,182,182,183,183,183,
+        178,178,178,178,178,178,178,178,178,178,179,179,179,179,179,179,180,180,180,180,250,250,250,250,250,182,182,182,182,182,183,183,
+        178,178,178,178,178,178,178,178,178,178,178,179,179,179,179,179,180,180,180,180,250,250,250,250,250,250,251,182,182,182,183,183,
+        148,148,148,149,149,149,149,149,149,149,149,149,150,150,150,150,150,151,151,151,251,251,251,251,251,251,251,251,251,153,153,153,
+        184,184,184,184,184,184,149,149,149,149,149,149,185,150,150,150,150,186,151,151,151,151,251,251,251,252,252,252,252,153,153,153,
+        184,184,184,184,184,184,184,184,184,149,149,185,185,185,185,150,186,186,186,186,151,187,187,187,252,252,252,252,252,153,189,189,
+        184,184,184,184,184,184,184,184,184,184,184,185,185,185,185,185,186,186,186,186,187,187,187,187,187,188,188,188,253,253,189,189,
+        184,184,184,184,184,184,184,184,184,184,184,184,185,185,185,185,185,186,186,186,186,187,187,187,187,187,253,253,253,254,254,189,
+        154,154,155,155,155,155,155,155,155,155,155,155,156,156,156,156,156,157,157,157,157,157,158,158,158,158,158,254,254,254,254,159,
+        154,154,190,190,190,190,155,155,155,155,155,155,191,156,156,156,156,192,157,157,157,157,193,158,158,158,158,194,159,159,159,159,
+        190,190,190,190,190,190,190,190,190,155,155,191,191,191,191,156,192,192,192,192,157,193,193,193,158,158,194,194,194,159,195,195,
+        160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,161,161,161,161,161,161,161,162,162,162,162,163,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,163,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,167,167,161,161,161,161,161,162,162,162,162,169,163,163,163,170,164,164,164,164,165,165,165,
+        166,166,166,166,166,166,166,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,169,170,170,170,170,170,171,171,171,171,
+        166,166,166,166,166,166,166,167,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,169,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,166,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,169,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,166,166,167,167,167,167,167,167,168,168,168,168,169,169,169,169,169,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,166,166,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,169,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,166,166,166,173,167,167,167,167,167,168,168,168,168,175,169,169,169,169,170,170,170,170,171,171,171,
+        172,172,172,172,172,172,172,173,173,173,173,173,173,173,174,174,174,174,174,175,175,175,175,175,176,176,176,176,177,177,177,177,
+        172,172,172,172,172,172,172,172,173,173,173,173,173,173,174,174,174,174,174,175,175,175,175,175,176,176,176,176,176,177,177,177,
+        172,172,172,172,172,172,172,172,172,173,173,173,173,173,173,174,174,174,174,174,175,175,175,175,175,176,176,176,176,177,177,177,
+        172,172,172,172,172,172,172,172,172,172,173,173,173,173,173,173,174,174,174,174,175,175,175,175,175,176,176,176,176,176,177,177,
+        178,178,178,172,172,172,172,172,172,179,179,179,173,173,173,180,180,174,174,181,181,181,175,175,182,182,182,176,176,183,183,177,
+        178,178,178,178,178,178,178,179,179,179,179,179,179,179,180,180,180,180,180,181,181,181,181,181,182,182,182,182,183,183,183,183,
+        178,178,178,178,178,178,178,178,178,179,179,179,179,179,179,180,180,180,180,181,181,181,181,181,182,182,182,182,182,183,183,183,
+        178,178,178,178,178,178,178,178,178,178,179,179,179,179,179,180,180,180,180,180,181,181,181,181,181,182,182,182,182,182,183,183,
+        178,178,178,178,178,178,178,178,178,178,178,179,179,179,179,179,180,180,180,180,250,250,250,251,251,251,182,182,182,182,183,183,
+        184,184,184,184,184,184,185,185,185,185,185,185,185,186,186,186,186,186,187,187,251,251,251,251,251,251,251,251,251,189,189,189,
+        184,184,184,184,184,184,184,184,185,185,185,185,185,185,186,186,186,186,186,187,187,187,187,252,252,252,252,252,252,189,189,189,
+        184,184,184,184,184,184,184,184,184,185,185,185,185,185,185,186,186,186,186,186,187,187,187,187,252,252,188,188,188,189,189,189,
+        184,184,184,184,184,184,184,184,184,184,185,185,185,185,185,185,186,186,186,186,187,187,187,187,187,253,253,253,253,253,189,189,
+        184,184,184,184,184,184,184,184,184,184,184,185,185,185,185,185,186,186,186,186,186,187,187,187,187,253,253,254,254,254,254,189,
+        190,190,190,190,190,190,191,191,191,191,191,191,191,192,192,192,192,192,193,193,193,193,193,194,194,194,194,254,254,254,254,254,
+        190,190,190,190,190,190,190,190,191,191,191,191,191,191,192,192,192,192,192,193,193,193,193,193,194,194,194,194,194,195,195,195,
+        190,190,190,190,190,190,190,190,190,191,191,191,191,191,191,192,192,192,192,192,193,193,193,193,194,194,194,194,194,195,195,195,
+        160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,161,161,161,161,161,161,161,162,162,162,162,163,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,161,161,161,161,161,161,161,162,162,162,162,163,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,161,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,163,163,163,163,163,164,164,164,164,165,165,165,
+        166,166,166,160,160,160,160,160,167,167,167,167,161,161,168,168,168,162,162,169,169,169,163,163,170,170,170,164,164,171,171,165,
+        166,166,166,166,166,166,167,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,169,170,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,167,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,169,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,166,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,169,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,166,166,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,166,166,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,169,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,166,166,173,173,173,167,167,167,174,168,168,168,168,175,169,169,169,176,176,170,170,170,177,171,171,
+        172,172,172,172,172,172,172,173,173,173,173,173,173,173,174,174,174,174,174,175,175,175,175,175,176,176,176,176,176,177,177,177,
+        172,172,172,172,172,172,172,172,173,173,173,173,173,173,174,174,174,174,174,175,175,175,175,175,176,176,176,176,176,177,177,177,
+        172,172,172,172,172,172,172,172,172,173,173,173,173,173,173,174,174,174,174,174,175,175,175,175,176,176,176,176,176,177,177,177,
+        172,172,172,172,172,172,172,172,172,172,173,173,173,173,173,173,174,174,174,174,175,175,175,175,175,176,176,176,176,176,177,177,
+        178,178,178,178,172,172,172,179,179,179,179,179,179,180,180,180,180,180,174,181,181,181,175,175,182,182,182,176,176,183,183,183,
+        178,178,178,178,178,178,178,179,179,179,179,179,179,179,180,180,180,180,180,181,181,181,181,182,182,182,182,182,183,183,183,183,
+        178,178,178,178,178,178,178,178,179,179,179,179,179,179,180,180,180,180,180,181,181,181,181,181,182,182,182,182,182,183,183,183,
+        178,178,178,178,178,178,178,178,178,179,179,179,179,179,179,180,180,180,180,180,181,181,181,181,181,182,182,182,182,183,183,183,
+        178,178,178,178,178,178,178,178,178,178,179,179,179,179,179,179,180,180,180,180,180,251,251,251,251,251,182,182,182,182,183,183,
+        184,184,184,184,184,184,185,185,185,185,185,185,185,186,186,186,186,186,187,187,187,251,251,251,251,251,252,252,189,189,189,189,
+        184,184,184,184,184,184,184,185,185,185,185,185,185,185,186,186,186,186,186,187,187,187,187,252,252,252,252,252,252,189,189,189,
+        184,184,184,184,184,184,184,184,185,185,185,185,185,185,185,186,186,186,186,187,187,187,187,187,188,188,188,188,188,189,189,189,
+        184,184,184,184,184,184,184,184,184,184,185,185,185,185,185,186,186,186,186,186,187,187,187,187,187,253,253,253,253,253,189,189,
+        184,184,184,184,184,184,184,184,184,184,184,185,185,185,185,185,186,186,186,186,186,187,187,187,187,254,254,254,254,254,254,254,
+        190,190,190,190,190,191,191,191,191,191,191,191,191,192,192,192,192,192,193,193,193,193,193,194,194,194,254,254,254,254,255,255,
+        190,190,190,190,190,190,190,191,191,191,191,191,191,191,192,192,192,192,192,193,193,193,193,193,194,194,194,194,195,195,195,195,
+        190,190,190,190,190,190,190,190,190,191,191,191,191,191,191,192,192,192,192,193,193,193,193,193,194,194,194,194,194,195,195,195,
+        160,160,160,160,160,160,160,160,161,161,161,161,161,161,161,162,162,162,162,163,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,161,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,161,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,164,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,163,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,161,161,161,161,161,161,161,162,162,162,162,163,163,163,163,163,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,167,167,161,161,161,161,161,162,162,162,162,163,163,163,163,163,164,164,164,164,165,165,165,
+        166,166,166,166,166,160,167,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,169,170,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,167,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,169,169,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,167,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,169,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,166,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,169,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,166,167,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,166,166,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,169,170,170,170,170,171,171,171,
+        172,166,166,166,166,166,166,173,173,173,173,173,167,167,174,174,174,168,168,175,175,175,169,169,176,176,176,170,170,177,177,177,
+        172,172,172,172,172,172,172,173,173,173,173,173,173,173,174,174,174,174,174,175,175,175,175,175,176,176,176,176,176,177,177,177,
+        172,172,172,172,172,172,172,172,173,173,173,173,173,173,174,174,174,174,174,175,175,175,175,175,176,176,176,176,176,177,177,177,
+        172,172,172,172,172,172,172,172,172,173,173,173,173,173,173,174,174,174,174,174,175,175,175,175,176,176,176,176,176,177,177,177,
+        172,172,172,172,172,172,172,172,172,172,173,173,173,173,173,173,174,174,174,174,175,175,175,175,175,176,176,176,176,176,177,177,
+        178,178,178,178,178,179,179,179,179,179,179,179,179,180,180,180,180,180,181,181,181,181,181,182,182,182,182,182,183,183,183,183,
+        178,178,178,178,178,178,179,179,179,179,179,179,179,180,180,180,180,180,181,181,181,181,181,182,182,182,182,182,183,183,183,183,
+        178,178,178,178,178,178,178,178,179,179,179,179,179,179,180,180,180,180,180,181,181,181,181,181,182,182,182,182,182,183,183,183,
+        178,178,178,178,178,178,178,178,178,179,179,179,179,179,179,180,180,180,180,180,181,181,181,181,181,182,182,182,182,183,183,183,
+        178,178,178,178,178,178,178,178,178,178,179,179,179,179,179,179,180,180,180,180,181,181,181,251,251,251,182,182,182,182,183,183,
+        184,184,184,184,184,185,185,185,185,185,185,185,185,186,186,186,186,186,187,187,187,251,251,252,252,252,252,252,189,189,189,189,
+        184,184,184,184,184,184,185,185,185,185,185,185,185,186,186,186,186,186,187,187,187,187,187,252,252,252,252,188,189,189,189,189,
+        184,184,184,184,184,184,184,184,185,185,185,185,185,185,186,186,186,186,186,187,187,187,187,187,188,188,188,253,253,189,189,189,
+        184,184,184,184,184,184,184,184,184,185,185,185,185,185,185,186,186,186,186,186,187,187,187,187,187,253,253,253,253,254,189,189,
+        184,184,184,184,184,184,184,184,184,184,185,185,185,185,185,185,186,186,186,186,186,187,187,187,187,254,254,254,254,254,254,254,
+        190,190,190,190,191,191,191,191,191,191,191,191,192,192,192,192,192,192,193,193,193,193,193,194,194,194,254,255,255,255,255,255,
+        190,190,190,190,190,190,191,191,191,191,191,191,191,192,192,192,192,192,193,193,193,193,193,194,194,194,194,194,195,195,195,195,
+        190,190,190,190,190,190,190,190,191,191,191,191,191,191,192,192,192,192,192,193,193,193,193,193,194,194,194,194,194,195,195,195,
+        160,160,160,160,160,160,160,160,161,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,163,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,161,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,163,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,161,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,163,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,161,161,161,161,161,161,162,162,162,162,162,163,163,163,163,163,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,160,160,160,197,161,161,161,161,161,162,162,162,162,162,163,163,163,163,163,164,164,164,164,165,165,165,
+        160,160,160,160,160,160,196,196,196,197,197,197,161,161,161,198,198,162,162,162,199,163,163,163,163,164,164,164,164,165,165,165,
+        196,196,196,196,196,196,196,196,196,197,197,197,197,197,197,198,198,198,198,162,199,199,199,163,200,200,164,164,164,201,165,165,
+        196,196,196,196,196,196,196,196,196,167,197,197,197,197,197,198,198,198,198,198,199,199,199,199,200,200,200,200,164,201,201,201,
+        166,166,166,196,196,196,196,167,167,167,167,167,167,197,168,168,168,198,198,169,169,169,169,199,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,167,167,167,167,167,167,167,168,168,168,168,168,168,169,169,169,169,169,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,167,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,169,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,166,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,169,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,166,167,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,170,170,170,170,170,171,171,171,
+        166,166,166,166,166,166,166,166,202,167,167,167,167,167,167,168,168,168,168,168,169,169,169,169,169,170,170,170,170,170,171,171,
+        172,172,172,202,202,202,202,173,173,173,173,173,173,174,174,174,174,204,204,175,175,175,205,205,176,176,176,176,170,177,177,177,
+        172,172,172,172,172,172,173,173,173,173,173,173,173,174,174,174,174,174,174,175,175,175,175,175,176,176,176,176,176,177,177,177,
+        172,172,172,172,172,172,172,173,173,173,173,173,173,173,174,174,174,174,174,175,175,175,175,175,176,176,176,176,176,177,177,177,
+        172,172,172,172,172,172,172,172,173,173,173,173,173,173,173,174,174,174,174,174,175,175,175,175,176,176,176,176,176,177,177,177,
+        172,172,172,172,172,172,172,208,208,208,173,173,173,173,173,174,174,174,174,174,175,175,175,175,175,176,176,176,176,176,177,177,
+        178,178,178,178,179,179,179,179,179,179,179,179,180,180,180,180,180,180,181,181,181,181,181,182,182,182,182,182,183,183,183,183,
+        178,178,178,178,178,178,179,179,179,179,179,179,179,180,180,180,180,180,181,181,181,181,181,182,182,182,182,182,183,183,183,183,
+        178,178,178,178,178,178,178,179,179,179,179,179,179,179,180,180,180,180,180,181,181,181,181,181,182,182,182,182,182,183,183,183,
+        178,178,178,178,178,178,178,178,179,179,179,179,179,179,179,180,180,180,180,180,181,181,181,181,181,182,182,182,182,183,183,183,
+        178,178,178,178,178,178,178,214,214,214,179,179,179,179,179,215,180,180,180,180,181,181,181,181,181,182,182,182,182,182,183,183,
+        184,184,184,185,185,185,185,185,185,185,185,185,186,186,186,186,186,187,187,187,187,187,252,252,252,252,252,252,189,189,189,189,
+        184,184,184,184,184,184,185,185,185,185,185,185,185,186,186,186,186,186,187,187,187,187,187,252,188,188,188,188,189,189,189,189,
+        184,184,184,184,184,184,184,185,185,185,185,185,185,185,186,186,186,186,186,187,187,187,187,187,253,253,253,253,253,189,189,189,
+        184,184,184,184,184,184,184,184,184,185,185,185,185,185,185,186,186,186,186,186,187,187,187,187,253,253,254,254,254,254,189,189,
+        184,184,184,184,184,184,184,220,220,220,220,185,185,185,221,221,186,186,186,222,222,187,187,223,254,254,254,254,254,254,254,254,
+        190,190,190,191,191,191,191,191,191,191,191,191,192,192,192,192,192,193,193,193,193,193,193,194,194,194,255,255,255,255,255,255,
+        190,190,190,190,190,191,191,191,191,191,191,191,191,192,192,192,192,192,193,193,193,193,193,194,194,194,194,194,255,255,255,255,
+        190,190,190,190,190,190,190,191,191,191,191,191,191,191,192,192,192,192,192,193,193,193,193,193,194,194,194,194,194,195,195,195,
+        196,196,196,196,196,196,196,196,197,197,197,197,197,197,198,198,198,198,198,199,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,197,197,197,197,197,197,198,198,198,198,198,199,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,197,197,197,197,197,197,198,198,198,198,198,199,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,197,197,197,197,197,197,198,198,198,198,198,199,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,196,197,197,197,197,197,197,198,198,198,198,199,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,196,197,197,197,197,197,197,198,198,198,198,199,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,196,197,197,197,197,197,197,198,198,198,198,198,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,196,196,197,197,197,197,197,198,198,198,198,198,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,9,9,9,9,197,197,197,197,198,198,198,198,199,199,199,199,199,200,200,200,200,13,13,13,
+        202,202,202,202,202,9,9,9,9,9,9,9,9,9,168,168,168,168,198,205,205,169,169,199,206,206,170,170,13,13,13,13,
+        202,202,202,202,202,202,9,9,9,9,9,9,9,9,204,204,204,204,204,205,205,205,205,205,206,206,206,206,13,13,13,13,
+        202,202,202,202,202,202,202,202,9,9,9,9,9,203,204,204,204,204,204,205,205,205,205,205,206,206,206,206,206,13,13,13,
+        202,202,202,202,202,202,202,202,202,9,203,203,203,203,203,204,204,204,204,205,205,205,205,205,206,206,206,206,206,207,207,207,
+        202,202,202,202,202,202,202,202,202,202,203,203,203,203,203,204,204,204,204,204,205,205,205,205,205,206,206,206,206,207,207,207,
+        202,202,202,202,202,202,202,202,202,202,203,203,203,203,203,203,204,204,204,204,205,205,205,205,205,206,206,206,206,207,207,207,
+        208,208,208,208,208,208,208,173,173,209,209,209,209,209,210,210,210,210,210,211,211,211,211,212,212,212,212,212,213,213,213,213,
+        208,208,208,208,208,208,208,208,208,209,209,209,209,209,210,210,210,210,210,211,211,211,211,211,212,212,212,212,212,213,213,213,
+        208,208,208,208,208,208,208,208,208,209,209,209,209,209,209,210,210,210,210,210,211,211,211,211,212,212,212,212,212,213,213,213,
+        208,208,208,208,208,208,208,208,208,208,209,209,209,209,209,209,210,210,210,210,211,211,211,211,211,212,212,212,212,212,213,213,
+        208,208,208,208,208,208,208,208,208,208,208,215,209,209,209,209,209,210,210,210,181,211,211,211,211,182,212,212,212,212,219,213,
+        214,214,214,214,214,214,214,179,179,215,215,215,215,215,216,216,216,216,216,217,217,217,217,217,218,218,218,218,219,219,219,219,
+        214,214,214,214,214,214,214,214,214,215,215,215,215,215,215,216,216,216,216,217,217,217,217,217,218,218,218,218,218,219,219,219,
+        214,214,214,214,214,214,214,214,214,214,215,215,215,215,215,215,216,216,216,216,217,217,217,217,217,218,218,218,218,218,219,219,
+        214,214,214,214,214,214,214,214,214,214,214,215,215,215,215,215,216,216,216,216,216,217,217,217,217,218,218,218,218,218,219,219,
+        220,220,220,220,185,185,185,185,185,185,185,221,186,186,186,186,222,222,187,187,187,223,252,252,252,252,252,218,189,189,189,189,
+        220,220,220,220,220,220,220,185,185,185,221,221,221,221,186,222,222,222,222,187,223,223,223,223,188,224,224,224,189,225,225,225,
+        220,220,220,220,220,220,220,220,220,221,221,221,221,221,221,222,222,222,222,222,223,223,223,223,224,224,224,224,224,225,225,225,
+        220,220,220,220,220,220,220,220,220,220,220,221,221,221,221,221,222,222,222,222,223,223,223,223,223,254,254,254,254,254,225,225,
+        220,220,220,220,220,220,220,220,220,220,220,220,221,221,221,221,221,222,222,222,222,223,223,223,223,254,254,254,254,255,255,255,
+        191,191,191,191,191,191,191,191,191,191,191,191,192,192,192,192,192,193,193,193,193,193,194,194,194,255,255,255,255,255,255,255,
+        226,226,226,226,226,226,226,191,191,11,11,227,227,227,192,192,228,228,228,193,193,229,229,229,194,230,230,230,255,255,255,255,
+        226,226,226,226,226,226,226,226,226,11,11,11,227,227,227,228,228,228,228,228,229,229,229,229,229,230,230,230,230,15,15,15,
+        196,196,196,196,196,196,196,196,197,197,197,197,197,197,198,198,198,198,198,199,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,197,197,197,197,197,197,198,198,198,198,198,199,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,197,197,197,197,197,197,197,198,198,198,198,199,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,196,197,197,197,197,197,197,198,198,198,198,199,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,196,197,197,197,197,197,197,198,198,198,198,199,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,196,197,197,197,197,197,197,198,198,198,198,198,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,196,197,197,197,197,197,197,198,198,198,198,198,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,196,9,197,197,197,197,197,198,198,198,198,198,199,199,199,199,199,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,9,9,9,9,9,197,197,197,197,198,198,198,198,205,199,199,199,199,200,200,200,200,13,13,13,
+        202,202,202,202,202,9,9,9,9,9,9,9,9,9,204,204,204,204,205,205,205,205,205,206,206,206,206,206,13,13,13,13,
+        202,202,202,202,202,202,9,9,9,9,9,9,9,9,204,204,204,204,204,205,205,205,205,205,206,206,206,206,13,13,13,13,
+        202,202,202,202,202,202,202,202,9,9,9,9,203,203,204,204,204,204,204,205,205,205,205,205,206,206,206,206,206,207,13,13,
+        202,202,202,202,202,202,202,202,202,203,203,203,203,203,203,204,204,204,204,205,205,205,205,205,206,206,206,206,206,207,207,207,
+        202,202,202,202,202,202,202,202,202,203,203,203,203,203,203,204,204,204,204,204,205,205,205,205,205,206,206,206,206,207,207,207,
+        202,202,202,202,202,202,202,202,202,202,209,203,203,203,203,203,204,204,204,204,211,205,205,205,205,206,206,206,206,206,207,207,
+        208,208,208,208,208,208,208,209,209,209,209,209,209,209,210,210,210,210,210,211,211,211,211,211,212,212,212,212,213,213,213,213,
+        208,208,208,208,208,208,208,208,209,209,209,209,209,209,210,210,210,210,210,211,211,211,211,211,212,212,212,212,212,213,213,213,
+        208,208,208,208,208,208,208,208,208,209,209,209,209,209,209,210,210,210,210,210,211,211,211,211,212,212,212,212,212,213,213,213,
+        208,208,208,208,208,208,208,208,208,208,209,209,209,209,209,209,210,210,210,210,211,211,211,211,211,212,212,212,212,212,213,213,
+        214,214,208,208,208,208,208,208,208,215,215,215,209,209,209,216,216,210,210,210,217,217,211,211,218,218,218,212,212,219,219,213,
+        214,214,214,214,214,214,214,215,215,215,215,215,215,215,216,216,216,216,216,217,217,217,217,217,218,218,218,218,219,219,219,219,
+        214,214,214,214,214,214,214,214,214,215,215,215,215,215,215,216,216,216,216,217,217,217,217,217,218,218,218,218,218,219,219,219,
+        214,214,214,214,214,214,214,214,214,214,215,215,215,215,215,216,216,216,216,216,217,217,217,217,217,218,218,218,218,219,219,219,
+        214,214,214,214,214,214,214,214,214,214,214,215,215,215,215,215,216,216,216,216,216,217,217,217,217,218,218,218,218,218,219,219,
+        220,220,220,220,220,220,221,221,221,221,221,221,221,222,222,222,222,222,223,223,223,223,223,224,224,224,224,224,225,225,225,225,
+        220,220,220,220,220,220,220,220,221,221,221,221,221,221,222,222,222,222,222,223,223,223,223,223,224,224,224,224,225,225,225,225,
+        220,220,220,220,220,220,220,220,220,221,221,221,221,221,221,222,222,222,222,223,223,223,223,223,224,224,224,224,224,225,225,225,
+        220,220,220,220,220,220,220,220,220,220,221,221,221,221,221,221,222,222,222,222,223,223,223,223,223,224,224,224,224,224,225,225,
+        220,220,220,220,220,220,220,220,220,220,220,221,221,221,221,221,221,222,222,222,222,223,223,223,223,254,255,255,255,255,255,255,
+        226,226,226,226,226,11,11,11,11,11,227,227,227,228,228,228,228,228,229,229,229,229,229,230,230,230,255,255,255,255,255,255,
+        226,226,226,226,226,226,226,11,11,11,11,227,227,227,228,228,228,228,228,229,229,229,229,229,230,230,230,230,255,255,15,15,
+        226,226,226,226,226,226,226,226,11,11,11,11,227,227,227,228,228,228,228,228,229,229,229,229,230,230,230,230,230,15,15,15,
+        196,196,196,196,196,196,196,196,197,197,197,197,197,197,197,198,198,198,198,199,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,197,197,197,197,197,197,197,198,198,198,198,199,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,197,197,197,197,197,197,197,198,198,198,198,199,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,196,197,197,197,197,197,197,198,198,198,198,198,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,196,197,197,197,197,197,197,198,198,198,198,198,199,199,199,199,200,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,196,197,197,197,197,197,197,198,198,198,198,198,199,199,199,199,199,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,196,197,197,197,197,197,197,198,198,198,198,198,199,199,199,199,199,200,200,200,200,201,201,201,
+        196,196,196,196,196,196,196,196,9,9,9,197,197,197,197,197,198,198,198,198,199,199,199,199,199,200,200,200,200,13,13,201,
+        202,202,196,196,196,9,9,9,9,9,9,9,9,197,204,204,204,198,198,205,205,205,199,199,206,206,206,200,13,13,13,13,
+        202,202,202,202,202,9,9,9,9,9,9,9,9,9,204,204,204,204,205,205,205,205,205,206,206,206,206,206,13,13,13,13,
+        202,202,202,202,202,202,9,9,9,9,9,9,9,9,204,204,204,204,204,205,205,205,205,205,206,206,206,206,206,13,13,13,
+        202,202,202,202,202,202,202,202,9,9,9,203,203,203,204,204,204,204,204,205,205,205,205,205,206,206,206,206,206,207,207,207,
+        202,202,202,202,202,202,202,202,202,203,203,203,203,203,203,204,204,204,204,204,205,205,205,205,206,206,206,206,206,207,207,207,
+        202,202,202,202,202,202,202,202,202,203,203,203,203,203,203,204,204,204,204,204,205,205,205,205,205,206,206,206,206,207,207,207,
+        202,202,202,202,202,202,202,202,202,209,209,209,203,203,203,210,204,204,204,204,211,205,205,205,212,212,206,206,206,213,213,207,
+        208,208,208,208,208,208,208,209,209,209,209,209,209,209,210,210,210,210,210,211,211,211,211,211,212,212,212,212,212,213,213,213,
+        208,208,208,208,208,208,208,208,209,209,209,209,209,209,210,210,210,210,210,211,211,211,211,211,212,212,212,212,212,213,213,213,
+        208,208,208,208,208,208,208,208,208,209,209,209,209,209,209,210,210,210,210,210,211,211,211,211,211,212,212,212,212,213,213,213,
+        208,208,208,208,208,208,208,208,208,208,209,209,209,209,209,209,210,210,210,210,211,211,211,211,211,212,212,212,212,212,213,213,
+        214,214,214,214,208,208,208,215,215,215,215,215,215,216,216,216,216,210,210,217,217,217,211,211,218,218,218,212,212,219,219,219,
+        214,214,214,214,214,214,214,215,215,215,215,215,215,215,216,216,216,216,216,217,217,217,217,218,218,218,218,218,219,219,219,219,
+        214,214,214,214,214,214,214,214,215,215,215,215,215,215,216,216,216,216,216,217,217,217,217,217,218,218,218,218,218,219,219,219,
+        214,214,214,214,214,214,214,214,214,215,215,215,215,215,215,216,216,216,216,216,217,217,217,217,217,218,218,218,218,219,219,219,
+        214,214,214,214,214,214,214,214,214,214,215,215,215,215,215,215,216,216,216,216,216,217,217,217,217,218,218,218,218,218,219,219,
+        220,220,220,220,220,221,221,221,221,221,221,221,221,222,222,222,222,222,223,223,223,223,223,224,224,224,224,224,225,225,225,225,
+        220,220,220,220,220,220,220,221,221,221,221,221,221,221,222,222,222,222,222,223,223,223,223,224,224,224,224,224,225,225,225,225,
+        220,220,220,220,220,220,220,220,221,221,221,221,221,221,221,222,222,222,222,223,223,223,223,223,224,224,224,224,224,225,225,225,
+        220,220,220,220,220,220,220,220,220,220,221,221,221,221,221,222,222,222,222,222,223,223,223,223,223,224,224,224,224,224,225,225,
+        220,220,220,220,220,220,220,220,220,220,220,221,221,221,221,221,222,222,222,222,222,223,223,223,223,255,255,255,255,255,255,225,
+        226,226,226,11,11,11,11,11,11,227,227,227,227,228,228,228,228,228,229,229,229,229,229,230,230,230,255,255,255,255,255,255,
+        226,226,226,226,226,226,11,11,11,11,227,227,227,227,228,228,228,228,228,229,229,229,229,229,230,230,230,230,15,15,15,15,
+        226,226,226,226,226,226,226,226,11,11,11,227,227,227,227,228,228,228,228,229,229,229,229,229,230,230,230,230,230,15,15,15,
+    };
+} /* namespace detail */
+
+} /* namespace ansi */
+
+} /* namespace plot */
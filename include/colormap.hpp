@@ -0,0 +1,175 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "color.hpp"
+#include "terminal.hpp"
+#include "utils.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+namespace plot
+{
+
+// Map scalars in [0, 1] to colors through a lookup table, built once
+// by interpolating between gradient stops. Each entry also stores
+// terminal codes (see TerminalColor), so writing a mapped color never
+// searches the ANSI palettes.
+class Colormap {
+public:
+    struct Stop {
+        float position;
+        Color color;
+    };
+
+    // Stops must be sorted by position; positions are rescaled
+    // so that the first and last stop map to 0 and 1
+    template<typename Iterator>
+    Colormap(Iterator first, Iterator last, std::size_t entries = 256) {
+        build(std::vector<Stop>(first, last), utils::max(entries, std::size_t(2)));
+    }
+
+    Colormap(std::initializer_list<Stop> stops, std::size_t entries = 256)
+        : Colormap(stops.begin(), stops.end(), entries)
+        {}
+
+    std::size_t size() const {
+        return colors_.size();
+    }
+
+    // Table index for t; values outside [0, 1] are clamped, NaN maps to 0
+    std::size_t index(float t) const {
+        if (!(t > 0.0f))
+            return 0;
+
+        if (t >= 1.0f)
+            return size() - 1;
+
+        return std::size_t(t*(size() - 1) + 0.5f);
+    }
+
+    Color operator()(float t) const {
+        return colors_[index(t)];
+    }
+
+    Color32 color32(float t) const {
+        return terminal_colors_[index(t)].color;
+    }
+
+    TerminalColor const& terminal_color(float t) const {
+        return terminal_colors_[index(t)];
+    }
+
+    // Perceptually uniform, dark blue to yellow
+    static Colormap const& viridis() {
+        static Colormap const map{
+            { 0.000f, Color(Color32{ 0x44, 0x01, 0x54, 0xff }) },
+            { 0.125f, Color(Color32{ 0x47, 0x2c, 0x7a, 0xff }) },
+            { 0.250f, Color(Color32{ 0x3b, 0x51, 0x8b, 0xff }) },
+            { 0.375f, Color(Color32{ 0x2c, 0x71, 0x8e, 0xff }) },
+            { 0.500f, Color(Color32{ 0x21, 0x90, 0x8d, 0xff }) },
+            { 0.625f, Color(Color32{ 0x27, 0xad, 0x81, 0xff }) },
+            { 0.750f, Color(Color32{ 0x5c, 0xc8, 0x63, 0xff }) },
+            { 0.875f, Color(Color32{ 0xaa, 0xdc, 0x32, 0xff }) },
+            { 1.000f, Color(Color32{ 0xfd, 0xe7, 0x25, 0xff }) }
+        };
+        return map;
+    }
+
+    // Perceptually uniform, black to light yellow through purple
+    static Colormap const& magma() {
+        static Colormap const map{
+            { 0.000f, Color(Color32{ 0x00, 0x00, 0x04, 0xff }) },
+            { 0.125f, Color(Color32{ 0x1c, 0x10, 0x44, 0xff }) },
+            { 0.250f, Color(Color32{ 0x4f, 0x12, 0x7b, 0xff }) },
+            { 0.375f, Color(Color32{ 0x81, 0x25, 0x81, 0xff }) },
+            { 0.500f, Color(Color32{ 0xb5, 0x36, 0x7a, 0xff }) },
+            { 0.625f, Color(Color32{ 0xe5, 0x50, 0x64, 0xff }) },
+            { 0.750f, Color(Color32{ 0xfb, 0x87, 0x61, 0xff }) },
+            { 0.875f, Color(Color32{ 0xfe, 0xc2, 0x87, 0xff }) },
+            { 1.000f, Color(Color32{ 0xfc, 0xfd, 0xbf, 0xff }) }
+        };
+        return map;
+    }
+
+    // Blue to red through light gray, for data centered on 0.5
+    static Colormap const& diverging() {
+        static Colormap const map{
+            { 0.00f, Color(Color32{ 0x3b, 0x4c, 0xc0, 0xff }) },
+            { 0.25f, Color(Color32{ 0x8d, 0xb0, 0xfe, 0xff }) },
+            { 0.50f, Color(Color32{ 0xdd, 0xdd, 0xdd, 0xff }) },
+            { 0.75f, Color(Color32{ 0xf4, 0x9a, 0x7b, 0xff }) },
+            { 1.00f, Color(Color32{ 0xb4, 0x04, 0x26, 0xff }) }
+        };
+        return map;
+    }
+
+private:
+    void build(std::vector<Stop> const& stops, std::size_t entries) {
+        colors_.resize(entries);
+        terminal_colors_.resize(entries);
+
+        if (stops.empty())
+            return;
+
+        auto start = stops.front().position,
+             range = stops.back().position - start;
+
+        auto next = stops.begin();
+
+        for (std::size_t i = 0; i < entries; ++i) {
+            auto pos = start + range*float(i)/float(entries - 1);
+
+            while (next != stops.end() && next->position < pos)
+                ++next;
+
+            Color c;
+            if (next == stops.begin()) {
+                c = stops.front().color;
+            } else if (next == stops.end()) {
+                c = stops.back().color;
+            } else {
+                auto prev = std::prev(next);
+                auto span = next->position - prev->position;
+                auto f = (span > 0.0f) ? (pos - prev->position)/span : 1.0f;
+                c = (1.0f - f)*prev->color + f*next->color;
+            }
+
+            // Round through Color32, so that all lookups agree
+            terminal_colors_[i] = TerminalColor(c);
+            colors_[i] = Color(terminal_colors_[i].color);
+        }
+    }
+
+    std::vector<Color> colors_;
+    std::vector<TerminalColor> terminal_colors_;
+};
+
+} /* namespace plot */
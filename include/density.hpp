@@ -0,0 +1,186 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "braille.hpp"
+#include "color.hpp"
+#include "point.hpp"
+#include "utils.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace plot
+{
+
+enum class DensityScale {
+    Linear,
+    Log
+};
+
+// Count hits per pixel, for plots where many points fall on the same
+// pixels. Counts are turned into dot patterns and colors when painted
+// onto a BrailleCanvas of the same size.
+class DensityCanvas {
+public:
+    using coord_type = Coord;
+    using point_type = Point;
+    using size_type = Size;
+    using rect_type = Rect;
+
+    DensityCanvas() = default;
+
+    DensityCanvas(Size char_sz)
+        : lines_(char_sz.y), cols_(char_sz.x),
+          counts_(std::size_t(char_sz.x*char_sz.y)*pixels_per_cell)
+        {}
+
+    Size char_size() const {
+        return { Coord(cols_), Coord(lines_) };
+    }
+
+    Size size() const {
+        return { Coord(cell_cols*cols_), Coord(cell_rows*lines_) };
+    }
+
+    // XXX: Counts wrap around past 2^32 - 1
+    DensityCanvas& add(Point p, std::uint32_t n = 1) {
+        auto x = std::size_t(p.x), y = std::size_t(p.y);
+        if (x < cell_cols*cols_ && y < cell_rows*lines_)
+            counts_[index(x, y)] += n;
+
+        return *this;
+    }
+
+    template<typename Iterator>
+    DensityCanvas& add(Iterator first, Iterator last) {
+        // Unsigned comparisons reject negative coordinates too
+        auto width = cell_cols*cols_, height = cell_rows*lines_;
+
+        for (; first != last; ++first) {
+            Point p = *first;
+            auto x = std::size_t(p.x), y = std::size_t(p.y);
+            if (x < width && y < height)
+                ++counts_[index(x, y)];
+        }
+
+        return *this;
+    }
+
+    std::uint32_t count(Point p) const {
+        auto x = std::size_t(p.x), y = std::size_t(p.y);
+        return (x < cell_cols*cols_ && y < cell_rows*lines_) ? counts_[index(x, y)] : 0;
+    }
+
+    DensityCanvas& clear() {
+        counts_.assign(counts_.size(), 0);
+        return *this;
+    }
+
+    // Change size; counts are cleared
+    DensityCanvas& resize(Size sz) {
+        if (sz != char_size()) {
+            lines_ = sz.y;
+            cols_ = sz.x;
+            counts_.assign(std::size_t(sz.x*sz.y)*pixels_per_cell, 0);
+        }
+        return *this;
+    }
+
+    // Paint counts onto canvas: pixels hit at least once are set, and each
+    // cell gets colormap(t), where t in [0, 1] is the cell total relative
+    // to the largest one. colormap is any callable taking a float and
+    // returning a Color.
+    template<typename Colormap>
+    DensityCanvas const& paint(BrailleCanvas& canvas, Colormap&& colormap,
+                               DensityScale scale = DensityScale::Log,
+                               TerminalOp op = TerminalOp::Over) const;
+
+private:
+    static constexpr std::size_t cell_cols = detail::braille::cell_cols;
+    static constexpr std::size_t cell_rows = detail::braille::cell_rows;
+    static constexpr std::size_t pixels_per_cell = cell_cols*cell_rows;
+
+    // Counts for the pixels of a cell are contiguous
+    std::size_t index(std::size_t x, std::size_t y) const {
+        return ((y / cell_rows)*cols_ + x / cell_cols)*pixels_per_cell +
+               (x % cell_cols)*cell_rows + y % cell_rows;
+    }
+
+    std::size_t lines_ = 0, cols_ = 0;
+    std::vector<std::uint32_t> counts_;
+};
+
+template<typename Colormap>
+DensityCanvas const& DensityCanvas::paint(BrailleCanvas& canvas, Colormap&& colormap,
+                                          DensityScale scale, TerminalOp op) const {
+    auto cells = cols_*lines_;
+
+    std::uint64_t max_total = 0;
+    for (std::size_t cell = 0; cell < cells; ++cell) {
+        auto const* px = &counts_[cell*pixels_per_cell];
+        std::uint64_t total = 0;
+        for (std::size_t i = 0; i < pixels_per_cell; ++i)
+            total += px[i];
+
+        max_total = utils::max(max_total, total);
+    }
+
+    if (!max_total)
+        return *this;
+
+    auto norm = (scale == DensityScale::Log) ? 1.0f/std::log1p(float(max_total)) : 1.0f/float(max_total);
+
+    auto sz = canvas.char_size();
+    auto lines = utils::min(lines_, std::size_t(sz.y)), cols = utils::min(cols_, std::size_t(sz.x));
+
+    for (std::size_t ln = 0; ln < lines; ++ln) {
+        for (std::size_t col = 0; col < cols; ++col) {
+            auto const* px = &counts_[(ln*cols_ + col)*pixels_per_cell];
+            std::uint64_t total = 0;
+            std::uint8_t mask = 0;
+
+            for (std::size_t x = 0; x < cell_cols; ++x) {
+                for (std::size_t y = 0; y < cell_rows; ++y) {
+                    auto n = px[x*cell_rows + y];
+                    total += n;
+                    if (n)
+                        mask |= detail::braille::pixel_codes[x][y];
+                }
+            }
+
+            if (!mask)
+                continue;
+
+            auto t = (scale == DensityScale::Log) ? std::log1p(float(total))*norm : float(total)*norm;
+            canvas.paint(ln, col, detail::braille::block_t(colormap(utils::clamp(t, 0.0f, 1.0f)), mask), op);
+        }
+    }
+
+    return *this;
+}
+
+} /* namespace plot */
@@ -0,0 +1,901 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "layout.hpp"
+#include "point.hpp"
+#include "terminal.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <new>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace plot
+{
+
+class AnyBlock;
+
+namespace detail
+{
+    // Objects are stored in a fixed-size buffer when they fit,
+    // on the heap otherwise
+    constexpr std::size_t any_buffer_size = 64;
+
+    struct alignas(std::max_align_t) any_buffer {
+        unsigned char data[any_buffer_size];
+    };
+
+    template<typename T, bool = (sizeof(T) <= sizeof(any_buffer) &&
+                                 alignof(T) <= alignof(any_buffer) &&
+                                 std::is_nothrow_move_constructible<T>::value)>
+    struct any_handler
+    {
+        static T* get(any_buffer& buf) {
+            return reinterpret_cast<T*>(buf.data);
+        }
+
+        static T const* get(any_buffer const& buf) {
+            return reinterpret_cast<T const*>(buf.data);
+        }
+
+        template<typename... Args>
+        static void create(any_buffer& buf, Args&&... args) {
+            new (buf.data) T(std::forward<Args>(args)...);
+        }
+
+        static void copy(any_buffer& dst, any_buffer const& src) {
+            new (dst.data) T(*get(src));
+        }
+
+        static void move(any_buffer& dst, any_buffer& src) {
+            new (dst.data) T(std::move(*get(src)));
+            get(src)->~T();
+        }
+
+        static void destroy(any_buffer& buf) {
+            get(buf)->~T();
+        }
+    };
+
+    template<typename T>
+    struct any_handler<T, false>
+    {
+        static T* get(any_buffer& buf) {
+            return *reinterpret_cast<T**>(buf.data);
+        }
+
+        static T const* get(any_buffer const& buf) {
+            return *reinterpret_cast<T const* const*>(buf.data);
+        }
+
+        template<typename... Args>
+        static void create(any_buffer& buf, Args&&... args) {
+            *reinterpret_cast<T**>(buf.data) = new T(std::forward<Args>(args)...);
+        }
+
+        static void copy(any_buffer& dst, any_buffer const& src) {
+            *reinterpret_cast<T**>(dst.data) = new T(*get(src));
+        }
+
+        static void move(any_buffer& dst, any_buffer& src) {
+            *reinterpret_cast<T**>(dst.data) = get(src);
+        }
+
+        static void destroy(any_buffer& buf) {
+            delete get(buf);
+        }
+    };
+
+    // Function table for type-erased blocks. A cursor is an iterator
+    // over the block lines, kept in a separate buffer.
+    struct any_block_ops
+    {
+        void (*copy)(any_buffer&, any_buffer const&);
+        void (*move)(any_buffer&, any_buffer&);
+        void (*destroy)(any_buffer&);
+        Size (*size)(any_buffer const&);
+        bool (*resize)(any_buffer&, Size);
+
+        void (*cursor_create)(any_buffer&, any_buffer const&);
+        void (*cursor_next)(any_buffer&);
+        void (*cursor_print)(std::ostream&, any_buffer const&);
+        void (*cursor_destroy)(any_buffer&);
+    };
+
+    template<typename Block>
+    struct any_block_impl
+    {
+        using handler = any_handler<Block>;
+        using iterator = typename block_traits<Block>::iterator;
+        using cursor_handler = any_handler<iterator>;
+
+        static Size size(any_buffer const& block) {
+            return block_traits<Block>::size(*handler::get(block));
+        }
+
+        static bool resize(any_buffer& block, Size sz) {
+            return block_traits<Block>::resize(*handler::get(block), sz);
+        }
+
+        static void cursor_create(any_buffer& cursor, any_buffer const& block) {
+            cursor_handler::create(cursor, block_traits<Block>::begin(*handler::get(block)));
+        }
+
+        static void cursor_next(any_buffer& cursor) {
+            ++*cursor_handler::get(cursor);
+        }
+
+        static void cursor_print(std::ostream& stream, any_buffer const& cursor) {
+            stream << **cursor_handler::get(cursor);
+        }
+
+        static any_block_ops const* ops() {
+            static const any_block_ops table = {
+                &handler::copy, &handler::move, &handler::destroy, &size, &resize,
+                &cursor_create, &cursor_next, &cursor_print, &cursor_handler::destroy
+            };
+            return &table;
+        }
+    };
+
+    // Function table of moved-from AnyBlocks: an empty block
+    // that owns nothing and has no lines
+    struct any_empty_block
+    {
+        static void copy(any_buffer&, any_buffer const&) {}
+        static void move(any_buffer&, any_buffer&) {}
+        static void destroy(any_buffer&) {}
+
+        static Size size(any_buffer const&) {
+            return {};
+        }
+
+        static bool resize(any_buffer&, Size) {
+            return false;
+        }
+
+        static void cursor_create(any_buffer&, any_buffer const&) {}
+        static void cursor_next(any_buffer&) {}
+        static void cursor_print(std::ostream&, any_buffer const&) {}
+
+        static any_block_ops const* ops() {
+            static const any_block_ops table = {
+                &copy, &move, &destroy, &size, &resize,
+                &cursor_create, &cursor_next, &cursor_print, &destroy
+            };
+            return &table;
+        }
+    };
+
+    struct dynamic_geometry {
+        std::size_t epoch = 0;
+        Size size;
+        std::vector<Size> sizes;
+        std::vector<Point> offsets;
+    };
+
+    struct grid_geometry : dynamic_geometry {
+        std::vector<Coord> columns, rows;
+        std::vector<Coord> column_offsets, row_offsets;
+    };
+
+    // Line of a dynamic block: rendering is delegated to the block,
+    // which keeps cursors to its children lines
+    template<typename Block>
+    class dynamic_line;
+
+    template<typename Block>
+    std::ostream& operator<<(std::ostream&, dynamic_line<Block> const&);
+
+    template<typename Block>
+    class dynamic_line {
+        friend class detail::block_iterator<Block, dynamic_line>;
+        friend Block;
+
+        friend std::ostream& operator<< <Block>(std::ostream&, dynamic_line const&);
+
+        dynamic_line(Block const* block, Coord row)
+            : block_(block), row_(row)
+            {}
+
+        dynamic_line next() const {
+            return { block_, row_ + 1 };
+        }
+
+        bool equal(dynamic_line const& other) const {
+            return row_ == other.row_;
+        }
+
+        Block const* block_ = nullptr;
+        Coord row_ = 0;
+
+    public:
+        dynamic_line() = default;
+    };
+
+    template<typename Block>
+    inline std::ostream& operator<<(std::ostream& stream, dynamic_line<Block> const& line) {
+        auto fill = stream.fill();
+        stream << std::setfill(' ');
+        line.block_->render_line(stream, line.row_);
+        return stream << std::setfill(fill);
+    }
+} /* namespace detail */
+
+
+// Type-erased block. Blocks up to detail::any_buffer_size bytes
+// are stored inline, larger blocks are allocated on the heap.
+//
+// A moved-from AnyBlock holds an empty block of size zero.
+//
+// Lines are rendered through a cursor kept by the AnyBlock itself:
+// sequential rendering costs O(1) per line, random access restarts
+// from the first line.
+//
+// XXX: Iterating the same AnyBlock concurrently from multiple
+// XXX: threads is not supported
+class AnyBlock {
+public:
+    using value_type = detail::dynamic_line<AnyBlock>;
+    using reference = value_type const&;
+    using const_reference = value_type const&;
+    using const_iterator = detail::block_iterator<AnyBlock, value_type>;
+    using iterator = const_iterator;
+    using difference_type = typename const_iterator::difference_type;
+    using size_type = Size;
+
+    template<typename Block, std::enable_if_t<!std::is_same<std::decay_t<Block>, AnyBlock>::value>* = nullptr>
+    AnyBlock(Block&& block)
+        : ops_(detail::any_block_impl<std::decay_t<Block>>::ops())
+    {
+        detail::any_handler<std::decay_t<Block>>::create(block_, std::forward<Block>(block));
+    }
+
+    AnyBlock(AnyBlock const& other)
+        : ops_(other.ops_)
+    {
+        ops_->copy(block_, other.block_);
+    }
+
+    // Blocks are stored inline only when their move constructor
+    // does not throw: moving never throws
+    AnyBlock(AnyBlock&& other) noexcept
+        : ops_(other.ops_)
+    {
+        // The cursor points into the moved-from block
+        other.reset_cursor();
+        ops_->move(block_, other.block_);
+        other.ops_ = detail::any_empty_block::ops();
+    }
+
+    ~AnyBlock() {
+        reset_cursor();
+        ops_->destroy(block_);
+    }
+
+    AnyBlock& operator=(AnyBlock const& other) {
+        if (this != &other) {
+            AnyBlock tmp(other);
+            *this = std::move(tmp);
+        }
+        return *this;
+    }
+
+    AnyBlock& operator=(AnyBlock&& other) noexcept {
+        if (this != &other) {
+            reset_cursor();
+            other.reset_cursor();
+            ops_->destroy(block_);
+
+            ops_ = other.ops_;
+            ops_->move(block_, other.block_);
+            other.ops_ = detail::any_empty_block::ops();
+        }
+        return *this;
+    }
+
+    Size size() const {
+        return ops_->size(block_);
+    }
+
+    const_iterator begin() const {
+        return cbegin();
+    }
+
+    const_iterator end() const {
+        return cend();
+    }
+
+    const_iterator cbegin() const {
+        return { { this, 0 } };
+    }
+
+    const_iterator cend() const {
+        return { { this, size().y } };
+    }
+
+    // Returns false if the underlying block cannot be resized
+    bool resize(Size sz) {
+        reset_cursor();
+        return ops_->resize(block_, sz);
+    }
+
+    // Write the specified line. Row must be in range [0, size().y)
+    void render_line(std::ostream& stream, Coord row) const {
+        // Restart on the first line: the block may have changed since last time
+        if (row == 0 || cursor_row_ < 0 || row < cursor_row_) {
+            reset_cursor();
+            ops_->cursor_create(cursor_, block_);
+            cursor_row_ = 0;
+        }
+
+        for (; cursor_row_ < row; ++cursor_row_)
+            ops_->cursor_next(cursor_);
+
+        ops_->cursor_print(stream, cursor_);
+    }
+
+private:
+    void reset_cursor() const {
+        if (cursor_row_ >= 0)
+            ops_->cursor_destroy(cursor_);
+        cursor_row_ = -1;
+    }
+
+    detail::any_block_ops const* ops_;
+    detail::any_buffer block_;
+
+    mutable detail::any_buffer cursor_;
+    mutable Coord cursor_row_ = -1;
+};
+
+inline std::ostream& operator<<(std::ostream& stream, AnyBlock const& block) {
+    for (auto const& line: block)
+        stream << line << '\n';
+
+    return stream;
+}
+
+
+// Vertical box with a variable number of children
+class DynamicVBox {
+public:
+    using value_type = detail::dynamic_line<DynamicVBox>;
+    using reference = value_type const&;
+    using const_reference = value_type const&;
+    using const_iterator = detail::block_iterator<DynamicVBox, value_type>;
+    using iterator = const_iterator;
+    using difference_type = typename const_iterator::difference_type;
+    using size_type = Size;
+
+    explicit DynamicVBox(std::size_t margin = 1)
+        : margin_(margin)
+        {}
+
+    template<typename Block>
+    DynamicVBox& add(Block&& block) {
+        blocks_.emplace_back(std::forward<Block>(block));
+        invalidate_layout();
+        return *this;
+    }
+
+    DynamicVBox& clear() {
+        blocks_.clear();
+        invalidate_layout();
+        return *this;
+    }
+
+    std::vector<AnyBlock> const& blocks() const {
+        return blocks_;
+    }
+
+    Size size() const {
+        return geometry().size;
+    }
+
+    const_iterator begin() const {
+        return cbegin();
+    }
+
+    const_iterator end() const {
+        return cend();
+    }
+
+    const_iterator cbegin() const {
+        return { { this, 0 } };
+    }
+
+    const_iterator cend() const {
+        return { { this, size().y } };
+    }
+
+    // Children are stacked top to bottom, left aligned
+    detail::dynamic_geometry const& geometry() const {
+        if (geometry_.epoch != detail::layout_epoch<>::value) {
+            geometry_.sizes.resize(blocks_.size());
+            geometry_.offsets.resize(blocks_.size());
+            geometry_.size = {};
+
+            Coord y = 0;
+            for (std::size_t i = 0; i < blocks_.size(); ++i) {
+                geometry_.sizes[i] = blocks_[i].size();
+                geometry_.offsets[i] = { 0, y };
+                y += geometry_.sizes[i].y + margin_;
+                geometry_.size.x = utils::max(geometry_.size.x, geometry_.sizes[i].x);
+            }
+
+            geometry_.size.y = blocks_.empty() ? 0 : y - margin_;
+            geometry_.epoch = detail::layout_epoch<>::value;
+        }
+
+        return geometry_;
+    }
+
+    void render_line(std::ostream& stream, Coord row) const {
+        auto const& geom = geometry();
+
+        // Lines are usually requested in order: try the last child first
+        if (current_ >= blocks_.size() || row < geom.offsets[current_].y)
+            current_ = std::upper_bound(geom.offsets.begin(), geom.offsets.end(), row, [](Coord r, Point const& offset) {
+                return r < offset.y;
+            }) - geom.offsets.begin() - 1;
+
+        while (current_ + 1 < blocks_.size() && row >= geom.offsets[current_ + 1].y)
+            ++current_;
+
+        auto line = row - geom.offsets[current_].y;
+        if (line < geom.sizes[current_].y) {
+            blocks_[current_].render_line(stream, line);
+            stream << std::setw(geom.size.x - geom.sizes[current_].x) << u8"";
+        } else {
+            stream << std::setw(geom.size.x) << u8"";
+        }
+    }
+
+private:
+    std::size_t margin_;
+    std::vector<AnyBlock> blocks_;
+    mutable detail::dynamic_geometry geometry_;
+    mutable std::size_t current_ = 0;
+};
+
+inline std::ostream& operator<<(std::ostream& stream, DynamicVBox const& vbox) {
+    for (auto const& line: vbox)
+        stream << line << '\n';
+
+    return stream;
+}
+
+
+// Horizontal box with a variable number of children
+class DynamicHBox {
+public:
+    using value_type = detail::dynamic_line<DynamicHBox>;
+    using reference = value_type const&;
+    using const_reference = value_type const&;
+    using const_iterator = detail::block_iterator<DynamicHBox, value_type>;
+    using iterator = const_iterator;
+    using difference_type = typename const_iterator::difference_type;
+    using size_type = Size;
+
+    explicit DynamicHBox(std::size_t margin = 2)
+        : margin_(margin)
+        {}
+
+    template<typename Block>
+    DynamicHBox& add(Block&& block) {
+        blocks_.emplace_back(std::forward<Block>(block));
+        invalidate_layout();
+        return *this;
+    }
+
+    DynamicHBox& clear() {
+        blocks_.clear();
+        invalidate_layout();
+        return *this;
+    }
+
+    std::vector<AnyBlock> const& blocks() const {
+        return blocks_;
+    }
+
+    Size size() const {
+        return geometry().size;
+    }
+
+    const_iterator begin() const {
+        return cbegin();
+    }
+
+    const_iterator end() const {
+        return cend();
+    }
+
+    const_iterator cbegin() const {
+        return { { this, 0 } };
+    }
+
+    const_iterator cend() const {
+        return { { this, size().y } };
+    }
+
+    // Children are placed left to right, top aligned
+    detail::dynamic_geometry const& geometry() const {
+        if (geometry_.epoch != detail::layout_epoch<>::value) {
+            geometry_.sizes.resize(blocks_.size());
+            geometry_.offsets.resize(blocks_.size());
+            geometry_.size = {};
+
+            Coord x = 0;
+            for (std::size_t i = 0; i < blocks_.size(); ++i) {
+                geometry_.sizes[i] = blocks_[i].size();
+                geometry_.offsets[i] = { x, 0 };
+                x += geometry_.sizes[i].x + margin_;
+                geometry_.size.y = utils::max(geometry_.size.y, geometry_.sizes[i].y);
+            }
+
+            geometry_.size.x = blocks_.empty() ? 0 : x - margin_;
+            geometry_.epoch = detail::layout_epoch<>::value;
+        }
+
+        return geometry_;
+    }
+
+    void render_line(std::ostream& stream, Coord row) const {
+        auto const& geom = geometry();
+
+        for (std::size_t i = 0; i < blocks_.size(); ++i) {
+            if (i)
+                stream << std::setw(margin_) << u8"";
+
+            if (row < geom.sizes[i].y)
+                blocks_[i].render_line(stream, row);
+            else
+                stream << std::setw(geom.sizes[i].x) << u8"";
+        }
+    }
+
+private:
+    std::size_t margin_;
+    std::vector<AnyBlock> blocks_;
+    mutable detail::dynamic_geometry geometry_;
+};
+
+inline std::ostream& operator<<(std::ostream& stream, DynamicHBox const& hbox) {
+    for (auto const& line: hbox)
+        stream << line << '\n';
+
+    return stream;
+}
+
+
+enum class TrackSizing
+{
+    Auto,
+    Fixed,
+    Fraction
+};
+
+// Sizing policy for a grid row or column
+struct Track {
+    // Fit the largest cell in the track
+    static Track content() {
+        return { TrackSizing::Auto, 0.0f };
+    }
+
+    // Fixed number of characters
+    static Track fixed(std::size_t size) {
+        return { TrackSizing::Fixed, float(size) };
+    }
+
+    // Share of the space left by other tracks, proportional to weight
+    static Track fraction(float weight = 1.0f) {
+        return { TrackSizing::Fraction, weight };
+    }
+
+    TrackSizing sizing;
+    float value;
+};
+
+namespace detail
+{
+    inline Track track_at(std::vector<Track> const& tracks, std::size_t index) {
+        return (index < tracks.size()) ? tracks[index] : Track::content();
+    }
+
+    // Sizes must contain the content size of each track on input.
+    // Fraction tracks share the space left by the others when some space
+    // is available, otherwise they fit their content.
+    inline void distribute_tracks(std::vector<Coord>& sizes, std::vector<Track> const& tracks,
+                                  Coord available, std::size_t margin) {
+        float weights = 0.0f;
+        Coord used = sizes.empty() ? 0 : Coord(margin*(sizes.size() - 1));
+
+        for (std::size_t i = 0; i < sizes.size(); ++i) {
+            auto track = track_at(tracks, i);
+            if (track.sizing == TrackSizing::Fraction) {
+                weights += utils::max(track.value, 0.0f);
+                continue;
+            }
+
+            if (track.sizing == TrackSizing::Fixed)
+                sizes[i] = Coord(track.value);
+
+            used += sizes[i];
+        }
+
+        if (available <= 0 || weights <= 0.0f)
+            return;
+
+        // Round cumulative shares so that tracks add up to the available space
+        auto space = utils::max(available - used, Coord(0));
+        float acc = 0.0f;
+        Coord assigned = 0;
+
+        for (std::size_t i = 0; i < sizes.size(); ++i) {
+            auto track = track_at(tracks, i);
+            if (track.sizing != TrackSizing::Fraction)
+                continue;
+
+            acc += utils::max(track.value, 0.0f);
+            auto end = Coord(std::lround(space*acc/weights));
+            sizes[i] = end - assigned;
+            assigned = end;
+        }
+    }
+} /* namespace detail */
+
+
+// Grid of blocks. Cells are filled in row-major order; column and row
+// sizes are set by track policies, auto-sized by default. Cells are aligned
+// to the top-left corner.
+//
+// A single call to resize() distributes the available space among
+// tracks and resizes children (canvases, frames, margins, ...) to fill
+// their cells; blocks which cannot be resized are padded. To track
+// the terminal size:
+//
+//     SizeWatcher watcher;
+//     ...
+//     watcher.poll([&](Size sz) { grid.resize(sz - Size(0, 1)); });
+class Grid {
+public:
+    using value_type = detail::dynamic_line<Grid>;
+    using reference = value_type const&;
+    using const_reference = value_type const&;
+    using const_iterator = detail::block_iterator<Grid, value_type>;
+    using iterator = const_iterator;
+    using difference_type = typename const_iterator::difference_type;
+    using size_type = Size;
+
+    explicit Grid(std::size_t columns, std::size_t vmargin = 1, std::size_t hmargin = 2)
+        : Grid(std::vector<Track>(utils::max(std::size_t(1), columns), Track::content()), {}, vmargin, hmargin)
+        {}
+
+    explicit Grid(std::vector<Track> columns, std::vector<Track> rows = {},
+                  std::size_t vmargin = 1, std::size_t hmargin = 2)
+        : column_tracks_(std::move(columns)), row_tracks_(std::move(rows)),
+          columns_(utils::max(std::size_t(1), column_tracks_.size())),
+          vmargin_(vmargin), hmargin_(hmargin)
+        {}
+
+    template<typename Block>
+    Grid& add(Block&& block) {
+        blocks_.emplace_back(std::forward<Block>(block));
+        invalidate_layout();
+        return *this;
+    }
+
+    Grid& clear() {
+        blocks_.clear();
+        invalidate_layout();
+        return *this;
+    }
+
+    std::vector<AnyBlock> const& blocks() const {
+        return blocks_;
+    }
+
+    std::size_t columns() const {
+        return columns_;
+    }
+
+    std::size_t rows() const {
+        return (blocks_.size() + columns_ - 1) / columns_;
+    }
+
+    // Lay out the grid in the given space, resizing children to fit
+    // their cells along fixed and fraction tracks. An empty size lets
+    // fraction tracks fit their content.
+    Grid& resize(Size available) {
+        available_ = available;
+
+        std::vector<Coord> widths, heights;
+        content_tracks(widths, heights);
+        detail::distribute_tracks(widths, column_tracks_, available_.x, hmargin_);
+        detail::distribute_tracks(heights, row_tracks_, available_.y, vmargin_);
+
+        for (std::size_t i = 0; i < blocks_.size(); ++i) {
+            auto col = i % columns_, row = i / columns_;
+            auto sz = blocks_[i].size();
+            Size target = {
+                (detail::track_at(column_tracks_, col).sizing == TrackSizing::Auto) ? sz.x : widths[col],
+                (detail::track_at(row_tracks_, row).sizing == TrackSizing::Auto) ? sz.y : heights[row]
+            };
+
+            if (target != sz)
+                blocks_[i].resize(target);
+        }
+
+        invalidate_layout();
+        return *this;
+    }
+
+    // Lay out the grid to fill the terminal
+    Grid& fit(TerminalInfo const& term) {
+        return resize(term.size());
+    }
+
+    Size size() const {
+        return geometry().size;
+    }
+
+    const_iterator begin() const {
+        return cbegin();
+    }
+
+    const_iterator end() const {
+        return cend();
+    }
+
+    const_iterator cbegin() const {
+        return { { this, 0 } };
+    }
+
+    const_iterator cend() const {
+        return { { this, size().y } };
+    }
+
+    // Cell sizes and offsets in row-major order; column widths
+    // and row heights are stored in tracks. Tracks grow to fit cells
+    // which could not be resized.
+    detail::grid_geometry const& geometry() const {
+        if (geometry_.epoch != detail::layout_epoch<>::value) {
+            geometry_.sizes.resize(blocks_.size());
+            geometry_.offsets.resize(blocks_.size());
+            for (std::size_t i = 0; i < blocks_.size(); ++i)
+                geometry_.sizes[i] = blocks_[i].size();
+
+            content_tracks(geometry_.columns, geometry_.rows);
+
+            auto widths = geometry_.columns, heights = geometry_.rows;
+            detail::distribute_tracks(widths, column_tracks_, available_.x, hmargin_);
+            detail::distribute_tracks(heights, row_tracks_, available_.y, vmargin_);
+
+            for (std::size_t col = 0; col < widths.size(); ++col)
+                geometry_.columns[col] = utils::max(geometry_.columns[col], widths[col]);
+
+            for (std::size_t row = 0; row < heights.size(); ++row)
+                geometry_.rows[row] = utils::max(geometry_.rows[row], heights[row]);
+
+            layout_tracks();
+        }
+
+        return geometry_;
+    }
+
+    void render_line(std::ostream& stream, Coord row) const {
+        auto const& geom = geometry();
+
+        // Lines are usually requested in order: try the last row first
+        if (current_ >= geom.rows.size() || row < geom.row_offsets[current_])
+            current_ = 0;
+
+        while (current_ + 1 < geom.rows.size() && row >= geom.row_offsets[current_ + 1])
+            ++current_;
+
+        auto line = row - geom.row_offsets[current_];
+        if (line >= geom.rows[current_]) {
+            stream << std::setw(geom.size.x) << u8"";
+            return;
+        }
+
+        for (std::size_t col = 0, cell = current_*columns_; col < columns_; ++col, ++cell) {
+            if (col)
+                stream << std::setw(hmargin_) << u8"";
+
+            if (cell < blocks_.size() && line < geom.sizes[cell].y) {
+                blocks_[cell].render_line(stream, line);
+                stream << std::setw(geom.columns[col] - geom.sizes[cell].x) << u8"";
+            } else {
+                stream << std::setw(geom.columns[col]) << u8"";
+            }
+        }
+    }
+
+private:
+    // Size of the largest cell in each track
+    void content_tracks(std::vector<Coord>& widths, std::vector<Coord>& heights) const {
+        widths.assign(columns_, 0);
+        heights.assign(rows(), 0);
+
+        for (std::size_t i = 0; i < blocks_.size(); ++i) {
+            auto sz = blocks_[i].size();
+            auto& width = widths[i % columns_];
+            auto& height = heights[i / columns_];
+            width = utils::max(width, sz.x);
+            height = utils::max(height, sz.y);
+        }
+    }
+
+    // Compute track offsets and cell offsets from track sizes
+    void layout_tracks() const {
+        geometry_.row_offsets.resize(geometry_.rows.size());
+        geometry_.column_offsets.resize(geometry_.columns.size());
+
+        Coord x = 0, y = 0;
+        for (std::size_t col = 0; col < geometry_.columns.size(); ++col) {
+            geometry_.column_offsets[col] = x;
+            x += geometry_.columns[col] + hmargin_;
+        }
+
+        for (std::size_t row = 0; row < geometry_.rows.size(); ++row) {
+            geometry_.row_offsets[row] = y;
+            y += geometry_.rows[row] + vmargin_;
+        }
+
+        for (std::size_t i = 0; i < blocks_.size(); ++i)
+            geometry_.offsets[i] = { geometry_.column_offsets[i % columns_], geometry_.row_offsets[i / columns_] };
+
+        geometry_.size = {
+            geometry_.columns.empty() ? 0 : x - Coord(hmargin_),
+            geometry_.rows.empty() ? 0 : y - Coord(vmargin_)
+        };
+        geometry_.epoch = detail::layout_epoch<>::value;
+    }
+
+    std::vector<Track> column_tracks_, row_tracks_;
+    std::size_t columns_, vmargin_, hmargin_;
+    Size available_;
+    std::vector<AnyBlock> blocks_;
+    mutable detail::grid_geometry geometry_;
+    mutable std::size_t current_ = 0;
+};
+
+inline std::ostream& operator<<(std::ostream& stream, Grid const& grid) {
+    for (auto const& line: grid)
+        stream << line << '\n';
+
+    return stream;
+}
+
+} /* namespace plot */
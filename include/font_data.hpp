@@ -0,0 +1,250 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * GENERATED BY scripts/font.py: DO NOT EDIT
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace plot
+{
+
+namespace detail
+{
+    // Template variables struct members should be linked only once
+    // though appearing in multiple translation units
+    template<typename = void>
+    struct font_tables {
+        // 3x5 glyphs for U+0020..U+007E, one byte per row,
+        // bit 2 is the leftmost pixel
+        static const std::uint8_t glyphs[][5];
+
+        // Braille masks of each glyph drawn in a 4x8 pixel box:
+        // top-left, top-right, bottom-left and bottom-right cells
+        static const std::uint8_t cells[][4];
+    };
+
+    template<typename T>
+    const std::uint8_t font_tables<T>::glyphs[][5] = {
+        { 0x00, 0x00, 0x00, 0x00, 0x00 }, // ' '
+        { 0x02, 0x02, 0x02, 0x00, 0x02 }, // '!'
+        { 0x05, 0x05, 0x00, 0x00, 0x00 }, // '"'
+        { 0x05, 0x07, 0x05, 0x07, 0x05 }, // '#'
+        { 0x03, 0x06, 0x02, 0x03, 0x06 }, // '$'
+        { 0x04, 0x01, 0x02, 0x04, 0x01 }, // '%'
+        { 0x02, 0x05, 0x02, 0x05, 0x03 }, // '&'
+        { 0x02, 0x02, 0x00, 0x00, 0x00 }, // "'"
+        { 0x01, 0x02, 0x02, 0x02, 0x01 }, // '('
+        { 0x04, 0x02, 0x02, 0x02, 0x04 }, // ')'
+        { 0x00, 0x05, 0x02, 0x05, 0x00 }, // '*'
+        { 0x00, 0x02, 0x07, 0x02, 0x00 }, // '+'
+        { 0x00, 0x00, 0x00, 0x02, 0x04 }, // ','
+        { 0x00, 0x00, 0x07, 0x00, 0x00 }, // '-'
+        { 0x00, 0x00, 0x00, 0x00, 0x02 }, // '.'
+        { 0x01, 0x01, 0x02, 0x04, 0x04 }, // '/'
+        { 0x07, 0x05, 0x05, 0x05, 0x07 }, // '0'
+        { 0x02, 0x06, 0x02, 0x02, 0x07 }, // '1'
+        { 0x07, 0x01, 0x07, 0x04, 0x07 }, // '2'
+        { 0x07, 0x01, 0x07, 0x01, 0x07 }, // '3'
+        { 0x05, 0x05, 0x07, 0x01, 0x01 }, // '4'
+        { 0x07, 0x04, 0x07, 0x01, 0x07 }, // '5'
+        { 0x07, 0x04, 0x07, 0x05, 0x07 }, // '6'
+        { 0x07, 0x01, 0x01, 0x02, 0x02 }, // '7'
+        { 0x07, 0x05, 0x07, 0x05, 0x07 }, // '8'
+        { 0x07, 0x05, 0x07, 0x01, 0x07 }, // '9'
+        { 0x00, 0x02, 0x00, 0x02, 0x00 }, // ':'
+        { 0x00, 0x02, 0x00, 0x02, 0x04 }, // ';'
+        { 0x01, 0x02, 0x04, 0x02, 0x01 }, // '<'
+        { 0x00, 0x07, 0x00, 0x07, 0x00 }, // '='
+        { 0x04, 0x02, 0x01, 0x02, 0x04 }, // '>'
+        { 0x07, 0x01, 0x02, 0x00, 0x02 }, // '?'
+        { 0x07, 0x05, 0x05, 0x04, 0x07 }, // '@'
+        { 0x02, 0x05, 0x07, 0x05, 0x05 }, // 'A'
+        { 0x06, 0x05, 0x06, 0x05, 0x06 }, // 'B'
+        { 0x03, 0x04, 0x04, 0x04, 0x03 }, // 'C'
+        { 0x06, 0x05, 0x05, 0x05, 0x06 }, // 'D'
+        { 0x07, 0x04, 0x06, 0x04, 0x07 }, // 'E'
+        { 0x07, 0x04, 0x06, 0x04, 0x04 }, // 'F'
+        { 0x03, 0x04, 0x05, 0x05, 0x03 }, // 'G'
+        { 0x05, 0x05, 0x07, 0x05, 0x05 }, // 'H'
+        { 0x07, 0x02, 0x02, 0x02, 0x07 }, // 'I'
+        { 0x01, 0x01, 0x01, 0x05, 0x02 }, // 'J'
+        { 0x05, 0x05, 0x06, 0x05, 0x05 }, // 'K'
+        { 0x04, 0x04, 0x04, 0x04, 0x07 }, // 'L'
+        { 0x05, 0x07, 0x07, 0x05, 0x05 }, // 'M'
+        { 0x06, 0x05, 0x05, 0x05, 0x05 }, // 'N'
+        { 0x02, 0x05, 0x05, 0x05, 0x02 }, // 'O'
+        { 0x06, 0x05, 0x06, 0x04, 0x04 }, // 'P'
+        { 0x02, 0x05, 0x05, 0x06, 0x03 }, // 'Q'
+        { 0x06, 0x05, 0x06, 0x05, 0x05 }, // 'R'
+        { 0x03, 0x04, 0x02, 0x01, 0x06 }, // 'S'
+        { 0x07, 0x02, 0x02, 0x02, 0x02 }, // 'T'
+        { 0x05, 0x05, 0x05, 0x05, 0x07 }, // 'U'
+        { 0x05, 0x05, 0x05, 0x05, 0x02 }, // 'V'
+        { 0x05, 0x05, 0x07, 0x07, 0x05 }, // 'W'
+        { 0x05, 0x05, 0x02, 0x05, 0x05 }, // 'X'
+        { 0x05, 0x05, 0x02, 0x02, 0x02 }, // 'Y'
+        { 0x07, 0x01, 0x02, 0x04, 0x07 }, // 'Z'
+        { 0x06, 0x04, 0x04, 0x04, 0x06 }, // '['
+        { 0x04, 0x04, 0x02, 0x01, 0x01 }, // '\\'
+        { 0x03, 0x01, 0x01, 0x01, 0x03 }, // ']'
+        { 0x02, 0x05, 0x00, 0x00, 0x00 }, // '^'
+        { 0x00, 0x00, 0x00, 0x00, 0x07 }, // '_'
+        { 0x04, 0x02, 0x00, 0x00, 0x00 }, // '`'
+        { 0x02, 0x05, 0x07, 0x05, 0x05 }, // 'a'
+        { 0x06, 0x05, 0x06, 0x05, 0x06 }, // 'b'
+        { 0x03, 0x04, 0x04, 0x04, 0x03 }, // 'c'
+        { 0x06, 0x05, 0x05, 0x05, 0x06 }, // 'd'
+        { 0x07, 0x04, 0x06, 0x04, 0x07 }, // 'e'
+        { 0x07, 0x04, 0x06, 0x04, 0x04 }, // 'f'
+        { 0x03, 0x04, 0x05, 0x05, 0x03 }, // 'g'
+        { 0x05, 0x05, 0x07, 0x05, 0x05 }, // 'h'
+        { 0x07, 0x02, 0x02, 0x02, 0x07 }, // 'i'
+        { 0x01, 0x01, 0x01, 0x05, 0x02 }, // 'j'
+        { 0x05, 0x05, 0x06, 0x05, 0x05 }, // 'k'
+        { 0x04, 0x04, 0x04, 0x04, 0x07 }, // 'l'
+        { 0x05, 0x07, 0x07, 0x05, 0x05 }, // 'm'
+        { 0x06, 0x05, 0x05, 0x05, 0x05 }, // 'n'
+        { 0x02, 0x05, 0x05, 0x05, 0x02 }, // 'o'
+        { 0x06, 0x05, 0x06, 0x04, 0x04 }, // 'p'
+        { 0x02, 0x05, 0x05, 0x06, 0x03 }, // 'q'
+        { 0x06, 0x05, 0x06, 0x05, 0x05 }, // 'r'
+        { 0x03, 0x04, 0x02, 0x01, 0x06 }, // 's'
+        { 0x07, 0x02, 0x02, 0x02, 0x02 }, // 't'
+        { 0x05, 0x05, 0x05, 0x05, 0x07 }, // 'u'
+        { 0x05, 0x05, 0x05, 0x05, 0x02 }, // 'v'
+        { 0x05, 0x05, 0x07, 0x07, 0x05 }, // 'w'
+        { 0x05, 0x05, 0x02, 0x05, 0x05 }, // 'x'
+        { 0x05, 0x05, 0x02, 0x02, 0x02 }, // 'y'
+        { 0x07, 0x01, 0x02, 0x04, 0x07 }, // 'z'
+        { 0x01, 0x02, 0x06, 0x02, 0x01 }, // '{'
+        { 0x02, 0x02, 0x02, 0x02, 0x02 }, // '|'
+        { 0x04, 0x02, 0x03, 0x02, 0x04 }, // '}'
+        { 0x00, 0x03, 0x06, 0x00, 0x00 }, // '~'
+    };
+
+    template<typename T>
+    const std::uint8_t font_tables<T>::cells[][4] = {
+        { 0x00, 0x00, 0x00, 0x00 }, // ' '
+        { 0xb0, 0x00, 0x10, 0x00 }, // '!'
+        { 0x06, 0x06, 0x00, 0x00 }, // '"'
+        { 0x66, 0x46, 0x0b, 0x03 }, // '#'
+        { 0xb4, 0x02, 0x1a, 0x01 }, // '$'
+        { 0x82, 0x04, 0x01, 0x02 }, // '%'
+        { 0x94, 0x04, 0x11, 0x03 }, // '&'
+        { 0x30, 0x00, 0x00, 0x00 }, // "'"
+        { 0xa0, 0x02, 0x08, 0x02 }, // '('
+        { 0xa2, 0x00, 0x0a, 0x00 }, // ')'
+        { 0x84, 0x04, 0x01, 0x01 }, // '*'
+        { 0xe0, 0x40, 0x08, 0x00 }, // '+'
+        { 0x00, 0x00, 0x0a, 0x00 }, // ','
+        { 0xc0, 0x40, 0x00, 0x00 }, // '-'
+        { 0x00, 0x00, 0x10, 0x00 }, // '.'
+        { 0x80, 0x06, 0x03, 0x00 }, // '/'
+        { 0x56, 0x46, 0x13, 0x03 }, // '0'
+        { 0xb4, 0x00, 0x1a, 0x02 }, // '1'
+        { 0xd2, 0x46, 0x13, 0x02 }, // '2'
+        { 0xd2, 0x46, 0x12, 0x03 }, // '3'
+        { 0xc6, 0x46, 0x00, 0x03 }, // '4'
+        { 0xd6, 0x42, 0x12, 0x03 }, // '5'
+        { 0xd6, 0x42, 0x13, 0x03 }, // '6'
+        { 0x12, 0x46, 0x18, 0x00 }, // '7'
+        { 0xd6, 0x46, 0x13, 0x03 }, // '8'
+        { 0xd6, 0x46, 0x12, 0x03 }, // '9'
+        { 0x20, 0x00, 0x08, 0x00 }, // ':'
+        { 0x20, 0x00, 0x0a, 0x00 }, // ';'
+        { 0x60, 0x02, 0x08, 0x02 }, // '<'
+        { 0x24, 0x04, 0x09, 0x01 }, // '='
+        { 0x22, 0x40, 0x0a, 0x00 }, // '>'
+        { 0x92, 0x06, 0x10, 0x00 }, // '?'
+        { 0x56, 0x46, 0x13, 0x02 }, // '@'
+        { 0xd4, 0x44, 0x03, 0x03 }, // 'A'
+        { 0xd6, 0x04, 0x13, 0x01 }, // 'B'
+        { 0x54, 0x02, 0x11, 0x02 }, // 'C'
+        { 0x56, 0x44, 0x13, 0x01 }, // 'D'
+        { 0xd6, 0x02, 0x13, 0x02 }, // 'E'
+        { 0xd6, 0x02, 0x03, 0x00 }, // 'F'
+        { 0x54, 0x42, 0x11, 0x03 }, // 'G'
+        { 0xc6, 0x46, 0x03, 0x03 }, // 'H'
+        { 0xb2, 0x02, 0x1a, 0x02 }, // 'I'
+        { 0x00, 0x46, 0x11, 0x01 }, // 'J'
+        { 0xc6, 0x06, 0x03, 0x03 }, // 'K'
+        { 0x46, 0x00, 0x13, 0x02 }, // 'L'
+        { 0xe6, 0x46, 0x03, 0x03 }, // 'M'
+        { 0x56, 0x44, 0x03, 0x03 }, // 'N'
+        { 0x54, 0x44, 0x11, 0x01 }, // 'O'
+        { 0xd6, 0x04, 0x03, 0x00 }, // 'P'
+        { 0x54, 0x44, 0x19, 0x02 }, // 'Q'
+        { 0xd6, 0x04, 0x03, 0x03 }, // 'R'
+        { 0x94, 0x02, 0x12, 0x01 }, // 'S'
+        { 0xb2, 0x02, 0x18, 0x00 }, // 'T'
+        { 0x46, 0x46, 0x13, 0x03 }, // 'U'
+        { 0x46, 0x46, 0x11, 0x01 }, // 'V'
+        { 0xc6, 0x46, 0x0b, 0x03 }, // 'W'
+        { 0x86, 0x06, 0x03, 0x03 }, // 'X'
+        { 0x86, 0x06, 0x18, 0x00 }, // 'Y'
+        { 0x92, 0x06, 0x13, 0x02 }, // 'Z'
+        { 0x56, 0x00, 0x13, 0x00 }, // '['
+        { 0x86, 0x00, 0x00, 0x03 }, // '\\'
+        { 0x10, 0x46, 0x10, 0x03 }, // ']'
+        { 0x14, 0x04, 0x00, 0x00 }, // '^'
+        { 0x00, 0x00, 0x12, 0x02 }, // '_'
+        { 0x22, 0x00, 0x00, 0x00 }, // '`'
+        { 0xd4, 0x44, 0x03, 0x03 }, // 'a'
+        { 0xd6, 0x04, 0x13, 0x01 }, // 'b'
+        { 0x54, 0x02, 0x11, 0x02 }, // 'c'
+        { 0x56, 0x44, 0x13, 0x01 }, // 'd'
+        { 0xd6, 0x02, 0x13, 0x02 }, // 'e'
+        { 0xd6, 0x02, 0x03, 0x00 }, // 'f'
+        { 0x54, 0x42, 0x11, 0x03 }, // 'g'
+        { 0xc6, 0x46, 0x03, 0x03 }, // 'h'
+        { 0xb2, 0x02, 0x1a, 0x02 }, // 'i'
+        { 0x00, 0x46, 0x11, 0x01 }, // 'j'
+        { 0xc6, 0x06, 0x03, 0x03 }, // 'k'
+        { 0x46, 0x00, 0x13, 0x02 }, // 'l'
+        { 0xe6, 0x46, 0x03, 0x03 }, // 'm'
+        { 0x56, 0x44, 0x03, 0x03 }, // 'n'
+        { 0x54, 0x44, 0x11, 0x01 }, // 'o'
+        { 0xd6, 0x04, 0x03, 0x00 }, // 'p'
+        { 0x54, 0x44, 0x19, 0x02 }, // 'q'
+        { 0xd6, 0x04, 0x03, 0x03 }, // 'r'
+        { 0x94, 0x02, 0x12, 0x01 }, // 's'
+        { 0xb2, 0x02, 0x18, 0x00 }, // 't'
+        { 0x46, 0x46, 0x13, 0x03 }, // 'u'
+        { 0x46, 0x46, 0x11, 0x01 }, // 'v'
+        { 0xc6, 0x46, 0x0b, 0x03 }, // 'w'
+        { 0x86, 0x06, 0x03, 0x03 }, // 'x'
+        { 0x86, 0x06, 0x18, 0x00 }, // 'y'
+        { 0x92, 0x06, 0x13, 0x02 }, // 'z'
+        { 0xe0, 0x02, 0x08, 0x02 }, // '{'
+        { 0xb0, 0x00, 0x18, 0x00 }, // '|'
+        { 0xa2, 0x40, 0x0a, 0x00 }, // '}'
+        { 0xe0, 0x04, 0x00, 0x00 }, // '~'
+    };
+} /* namespace detail */
+
+} /* namespace plot */
@@ -31,6 +31,7 @@
 #include "utils.hpp"
 
 #include <algorithm>
+#include <array>
 #include <iomanip>
 #include <iterator>
 #include <ostream>
@@ -42,6 +43,28 @@ namespace plot
 
 namespace detail
 {
+    // Template variables struct members should be linked only once
+    // though appearing in multiple translation units
+    template<typename = void>
+    struct layout_epoch {
+        static std::size_t value;
+    };
+
+    template<typename T>
+    std::size_t layout_epoch<T>::value = 1;
+} /* namespace detail */
+
+// Container blocks cache their geometry until the layout is invalidated.
+// Canvases invalidate the layout automatically when resized; this function
+// must be called after changing the size of any other block.
+inline void invalidate_layout() {
+    ++detail::layout_epoch<>::value;
+}
+
+namespace detail
+{
+    struct layout_compiler;
+
     template<typename Block, typename Line>
     class block_iterator
     {
@@ -162,6 +185,18 @@ namespace detail
         static constexpr bool value = test<T>(0);
     };
 
+    // Blocks may be resized (in characters) if they provide a resize(Size) method
+    template<typename Block>
+    inline auto resize_block(Block& block, Size sz, int) -> decltype(block.resize(sz), bool()) {
+        block.resize(sz);
+        return true;
+    }
+
+    template<typename Block>
+    inline bool resize_block(Block&, Size, long) {
+        return false;
+    }
+
     template<typename Block, bool = std::is_same<Size, decltype(std::declval<Block>().size())>::value>
     struct normal_block_ref_traits
     {
@@ -178,6 +213,10 @@ namespace detail
         static iterator end(Block const& block) {
             return { &block, true };
         }
+
+        static bool resize(Block&, Size) {
+            return false;
+        }
     };
 
     template<typename Block>
@@ -196,6 +235,10 @@ namespace detail
         static iterator end(Block const& block) {
             return std::end(block);
         }
+
+        static bool resize(Block& block, Size sz) {
+            return resize_block(block, sz, 0);
+        }
     };
 
     template<typename Block, bool = is_canvas<Block>::value>
@@ -228,6 +271,10 @@ namespace detail
         static auto end(Block* block) {
             return block_ref_traits<Block>::end(*block);
         }
+
+        static bool resize(Block* block, Size sz) {
+            return block_ref_traits<Block>::resize(*block, sz);
+        }
     };
 } /* namespace detail */
 
@@ -323,6 +370,64 @@ struct Border {
 };
 
 
+namespace detail
+{
+    // Text measured once, along with its clamp point for a box width.
+    // A box width of 0 fits the whole text.
+    class prepared_text {
+    public:
+        prepared_text() = default;
+
+        explicit prepared_text(string_view text, std::size_t box = 0)
+            : text_(text), natural_(utf8_string_width(text))
+        {
+            fit(box);
+        }
+
+        void fit(std::size_t box) {
+            box_ = box ? box : natural_;
+
+            if (natural_ <= box_) {
+                visible_ = text_;
+                visible_width_ = natural_;
+            } else {
+                std::tie(visible_, visible_width_) = utf8_clamp(text_, box_);
+            }
+        }
+
+        string_view text() const {
+            return text_;
+        }
+
+        std::size_t width() const {
+            return box_;
+        }
+
+        // Write text aligned in the box, padded with fill
+        void write(std::ostream& stream, Align align, string_view fill) const {
+            std::size_t padding = box_ - visible_width_;
+            std::size_t padding_left =
+                (align == Align::Center) ? padding / 2 :
+                    (align == Align::Right) ? padding : 0;
+            std::size_t padding_right = padding - padding_left;
+
+            // Unformatted output avoids a sentry and width handling per fill
+            while (padding_left--)
+                stream.write(fill.data(), std::streamsize(fill.size()));
+
+            stream.write(visible_.data(), std::streamsize(visible_.size()));
+
+            while (padding_right--)
+                stream.write(fill.data(), std::streamsize(fill.size()));
+        }
+
+    private:
+        string_view text_, visible_;
+        std::size_t natural_ = 0, box_ = 0, visible_width_ = 0;
+    };
+} /* namespace detail */
+
+
 class Label;
 
 namespace detail
@@ -368,15 +473,22 @@ public:
     using size_type = Size;
 
     explicit Label(string_view text, std::size_t width = 0, string_view fill = " ")
-        : text_(text), width_(width), fill_(fill)
+        : text_(text, width), fill_(fill)
         {}
 
     explicit Label(string_view text, Align align, std::size_t width = 0, string_view fill = " ")
-        : text_(text), align_(align), width_(width), fill_(fill)
+        : text_(text, width), align_(align), fill_(fill)
         {}
 
     Size size() const {
-        return { Coord(width_ ? width_ : utf8_string_width(text_)), 1 };
+        return { Coord(text_.width()), 1 };
+    }
+
+    // Labels are always one line tall: only width is changed
+    Label& resize(Size sz) {
+        text_.fit(std::size_t(utils::max(sz.x, Coord(0))));
+        invalidate_layout();
+        return *this;
     }
 
     const_iterator begin() const {
@@ -398,9 +510,8 @@ public:
 private:
     friend std::ostream& detail::operator<<(std::ostream&, value_type const&);
 
-    string_view text_;
+    detail::prepared_text text_;
     Align align_ = Align::Left;
-    std::size_t width_ = 0;
     string_view fill_ = " ";
 };
 
@@ -414,30 +525,7 @@ inline std::ostream& operator<<(std::ostream& stream, Label const& label) {
 namespace detail
 {
     inline std::ostream& operator<<(std::ostream& stream, label_line const& line) {
-        auto const text = line.label_->text_;
-        auto const twidth = utf8_string_width(text);
-        auto const width = line.label_->width_;
-
-        if (!width || twidth == width)
-            return stream << text;
-
-        if (twidth > width)
-            return stream << utf8_clamp(text, width).first;
-
-        std::size_t padding = width - twidth;
-        std::size_t padding_left =
-            (line.label_->align_ == Align::Center) ? padding / 2 :
-                (line.label_->align_ == Align::Right) ? padding : 0;
-        std::size_t padding_right = padding - padding_left;
-
-        while (padding_left--)
-            stream << line.label_->fill_;
-
-        stream << text;
-
-        while (padding_right--)
-            stream << line.label_->fill_;
-
+        line.label_->text_.write(stream, line.label_->align_, line.label_->fill_);
         return stream;
     }
 } /* namespace detail */
@@ -551,6 +639,13 @@ public:
         return { utils::max(block_sz.x, size_.x), utils::max(block_sz.y, size_.y) };
     }
 
+    // Change the size of the aligned area, the block is left untouched
+    Alignment& resize(Size sz) {
+        size_ = sz;
+        invalidate_layout();
+        return *this;
+    }
+
     const_iterator begin() const {
         return cbegin();
     }
@@ -590,6 +685,7 @@ public:
     }
 
 private:
+    friend struct detail::layout_compiler;
     friend std::ostream& detail::operator<< <Block>(std::ostream&, value_type const&);
 
     Align halign_ = Align::Center;
@@ -725,6 +821,14 @@ public:
         return detail::block_traits<Block>::size(block_) + Size(left_ + right_, top_ + bottom_);
     }
 
+    Margin& resize(Size sz) {
+        detail::block_traits<Block>::resize(block_, {
+            utils::max(sz.x - Coord(left_ + right_), Coord(0)),
+            utils::max(sz.y - Coord(top_ + bottom_), Coord(0))
+        });
+        return *this;
+    }
+
     const_iterator begin() const {
         return cbegin();
     }
@@ -742,6 +846,7 @@ public:
     }
 
 private:
+    friend struct detail::layout_compiler;
     friend std::ostream& detail::operator<< <Block>(std::ostream&, value_type const&);
 
     std::size_t top_ = 1, right_ = 2, bottom_ = 1, left_ = 2;
@@ -842,24 +947,41 @@ public:
 
     explicit Frame(string_view label, Block block, TerminalInfo term = TerminalInfo())
         : label_(label), block_(std::move(block)), term_(term)
-        {}
+    {
+        fit_label();
+    }
 
     explicit Frame(string_view label, Align align, Block block, TerminalInfo term = TerminalInfo())
         : label_(label), align_(align), block_(std::move(block)), term_(term)
-        {}
+    {
+        fit_label();
+    }
 
     explicit Frame(string_view label, Border border, Block block, TerminalInfo term = TerminalInfo())
         : label_(label), border_(border), block_(std::move(block)), term_(term)
-        {}
+    {
+        fit_label();
+    }
 
     explicit Frame(string_view label, Align align, Border border, Block block, TerminalInfo term = TerminalInfo())
         : label_(label), align_(align), border_(border), block_(std::move(block)), term_(term)
-        {}
+    {
+        fit_label();
+    }
 
     Size size() const {
         return detail::block_traits<Block>::size(block_) + Size(2, 2);
     }
 
+    Frame& resize(Size sz) {
+        detail::block_traits<Block>::resize(block_, {
+            utils::max(sz.x - 2, Coord(0)),
+            utils::max(sz.y - 2, Coord(0))
+        });
+        fit_label();
+        return *this;
+    }
+
     const_iterator begin() const {
         return cbegin();
     }
@@ -877,11 +999,19 @@ public:
     }
 
 private:
+    friend struct detail::layout_compiler;
     template<typename>
     friend class detail::frame_line;
     friend std::ostream& detail::operator<< <Block>(std::ostream&, value_type const&);
 
-    string_view label_;
+    void fit_label() {
+        auto width = std::size_t(detail::block_traits<Block>::size(block_).x);
+        if (label_.width() != width)
+            label_.fit(width);
+    }
+
+    // Title is refitted by resize(), rendering never modifies it
+    detail::prepared_text label_;
     Align align_ = Align::Left;
     Border border_{BorderStyle::Solid};
     Block block_;
@@ -904,11 +1034,19 @@ namespace detail
         auto const border = line.frame_->border_;
 
         if (line.overflow_ < 0) {
-            auto lbl = label(line.frame_->label_, line.frame_->align_, size.x, border.top);
-            auto lbl_line = *lbl.cbegin();
-
-            return stream << line.frame_->term_.reset()
-                          << border.top_left << lbl_line << border.top_right;
+            auto const& title = line.frame_->label_;
+
+            stream << line.frame_->term_.reset() << border.top_left;
+            if (title.width() == std::size_t(size.x)) {
+                title.write(stream, line.frame_->align_, border.top);
+            } else {
+                // The block changed width on its own, without a resize:
+                // fit a copy rather than the shared title
+                auto fitted = title;
+                fitted.fit(std::size_t(size.x));
+                fitted.write(stream, line.frame_->align_, border.top);
+            }
+            return stream << border.top_right;
         } else if (line.line_ == line.end_) {
             stream << line.frame_->term_.reset() << border.bottom_left;
 
@@ -962,27 +1100,6 @@ class VBox;
 
 namespace detail
 {
-    struct plus_identity {};
-
-    template<typename Arg>
-    inline constexpr decltype(auto) operator+(plus_identity, Arg&& arg) {
-        return std::forward<Arg>(arg);
-    }
-
-    template<typename Arg>
-    inline constexpr decltype(auto) operator+(Arg&& arg, plus_identity) {
-        return std::forward<Arg>(arg);
-    }
-
-    inline constexpr plus_identity plus_fold() {
-        return {};
-    }
-
-    template<typename Arg, typename... Args>
-    inline constexpr auto plus_fold(Arg&& first, Args&&... rest) {
-        return std::forward<Arg>(first) + plus_fold(std::forward<Args>(rest)...);
-    }
-
     inline constexpr std::size_t find_true(std::size_t index) {
         return index;
     }
@@ -997,6 +1114,16 @@ namespace detail
         return first ? 0 : find_true(std::size_t(1), std::forward<Args>(rest)...);
     }
 
+    // Cached box geometry: children sizes and offsets relative
+    // to the box origin
+    template<std::size_t N>
+    struct box_geometry {
+        std::size_t epoch = 0;
+        Size size;
+        std::array<Size, N> sizes;
+        std::array<Point, N> offsets;
+    };
+
     template<typename... Blocks>
     class vbox_line;
 
@@ -1060,31 +1187,31 @@ namespace detail
     inline std::ostream& output_vbox_line(std::ostream& stream, std::size_t width, Arg&& first, Args&&... rest) {
         return (std::get<0>(std::forward<Arg>(first)) != std::get<1>(std::forward<Arg>(first)))
             ? (stream << *std::get<0>(std::forward<Arg>(first))
-                      << std::setw(width - detail::block_traits<std::decay_t<std::tuple_element_t<2, std::decay_t<Arg>>>>
-                          ::size(std::get<2>(std::forward<Arg>(first))).x) << u8"")
+                      << std::setw(width - std::get<2>(std::forward<Arg>(first)).x) << u8"")
             : output_vbox_line(stream, width, std::forward<Args>(rest)...);
     }
 
-    template<typename Iterators, typename Blocks, std::size_t... N>
+    template<typename Iterators, std::size_t... N>
     inline std::ostream& output_vbox_line(std::ostream& stream,
                                           std::size_t width,
                                           Iterators const& lines,
                                           Iterators const& ends,
-                                          Blocks const& blocks,
+                                          std::array<Size, sizeof...(N)> const& sizes,
                                           std::index_sequence<N...>) {
         return output_vbox_line(
-            stream, width, std::forward_as_tuple(std::get<N>(lines), std::get<N>(ends), std::get<N>(blocks))...);
+            stream, width, std::forward_as_tuple(std::get<N>(lines), std::get<N>(ends), sizes[N])...);
     }
 
     template<typename... Blocks>
     inline std::ostream& operator<<(std::ostream& stream, vbox_line<Blocks...> const& line) {
         auto fill = stream.fill();
-        auto width = line.vbox_->size().x;
+        auto const& geometry = line.vbox_->geometry();
+        auto width = geometry.size.x;
 
         stream << std::setfill(' ');
 
         if (!line.margin_)
-            output_vbox_line(stream, width, line.lines_, line.ends_, line.vbox_->blocks_,
+            output_vbox_line(stream, width, line.lines_, line.ends_, geometry.sizes,
                              std::make_index_sequence<sizeof...(Blocks)>());
         else
             stream << std::setw(width) << u8"";
@@ -1114,8 +1241,7 @@ public:
         {}
 
     Size size() const {
-        return size_impl(std::make_index_sequence<sizeof...(Blocks)>()) +
-            Size(0, margin_*(sizeof...(Blocks) - 1));
+        return geometry().size;
     }
 
     const_iterator begin() const {
@@ -1136,20 +1262,38 @@ public:
         return { { this, margin_, e, e } };
     }
 
+    // Children are stacked top to bottom, left aligned
+    detail::box_geometry<sizeof...(Blocks)> const& geometry() const {
+        if (geometry_.epoch != detail::layout_epoch<>::value) {
+            geometry_.sizes = sizes(std::make_index_sequence<sizeof...(Blocks)>());
+            geometry_.size = { 0, Coord(margin_*(sizeof...(Blocks) - 1)) };
+
+            Coord y = 0;
+            for (std::size_t i = 0; i < sizeof...(Blocks); ++i) {
+                geometry_.offsets[i] = { 0, y };
+                y += geometry_.sizes[i].y + margin_;
+                geometry_.size.x = utils::max(geometry_.size.x, geometry_.sizes[i].x);
+                geometry_.size.y += geometry_.sizes[i].y;
+            }
+
+            geometry_.epoch = detail::layout_epoch<>::value;
+        }
+
+        return geometry_;
+    }
+
 private:
+    friend struct detail::layout_compiler;
     friend value_type;
 
     friend std::ostream& detail::operator<< <Blocks...>(std::ostream&, value_type const&);
 
     template<std::size_t... N>
-    Size size_impl(std::index_sequence<N...>) const {
-        return {
-            std::max({ detail::block_traits<std::tuple_element_t<N, decltype(blocks_)>>
-                ::size(std::get<N>(blocks_)).x... }),
-            detail::plus_fold(
-                detail::block_traits<std::tuple_element_t<N, decltype(blocks_)>>
-                    ::size(std::get<N>(blocks_)).y...)
-        };
+    std::array<Size, sizeof...(Blocks)> sizes(std::index_sequence<N...>) const {
+        return {{
+            detail::block_traits<std::tuple_element_t<N, decltype(blocks_)>>
+                ::size(std::get<N>(blocks_))...
+        }};
     }
 
     template<std::size_t... N>
@@ -1170,6 +1314,7 @@ private:
 
     std::size_t margin_ = 1;
     std::tuple<Blocks...> blocks_;
+    mutable detail::box_geometry<sizeof...(Blocks)> geometry_;
 };
 
 template<typename Block, typename... Blocks>
@@ -1249,30 +1394,29 @@ namespace detail
         return output_hbox_line(
             ((std::get<0>(std::forward<Arg>(first)) != std::get<1>(std::forward<Arg>(first)))
                 ? stream << std::setw(margin) << u8"" << *std::get<0>(std::forward<Arg>(first))
-                : stream << std::setw(margin + detail::block_traits<std::decay_t<std::tuple_element_t<2, std::decay_t<Arg>>>>
-                    ::size(std::get<2>(std::forward<Arg>(first))).x) << u8""),
+                : stream << std::setw(margin + std::get<2>(std::forward<Arg>(first)).x) << u8""),
             margin, std::forward<Args>(rest)...);
     }
 
-    template<typename Iterators, typename Blocks, std::size_t... N>
+    template<typename Iterators, std::size_t... N>
     inline std::ostream& output_hbox_line(std::ostream& stream,
                                           std::size_t margin,
                                           Iterators const& lines,
                                           Iterators const& ends,
-                                          Blocks const& blocks,
+                                          std::array<Size, sizeof...(N) + 1> const& sizes,
                                           std::index_sequence<N...>) {
         return output_hbox_line(
             ((std::get<0>(lines) != std::get<0>(ends))
                 ? stream << *std::get<0>(lines)
-                : stream << std::setw(detail::block_traits<std::decay_t<std::tuple_element_t<0, Blocks>>>
-                    ::size(std::get<0>(blocks)).x) << u8""),
-            margin, std::forward_as_tuple(std::get<N+1>(lines), std::get<N+1>(ends), std::get<N+1>(blocks))...);
+                : stream << std::setw(sizes[0].x) << u8""),
+            margin, std::forward_as_tuple(std::get<N+1>(lines), std::get<N+1>(ends), sizes[N+1])...);
     }
 
     template<typename... Blocks>
     inline std::ostream& operator<<(std::ostream& stream, hbox_line<Blocks...> const& line) {
         auto fill = stream.fill();
-        return output_hbox_line(stream << std::setfill(' '), line.margin_, line.lines_, line.ends_, line.hbox_->blocks_,
+        return output_hbox_line(stream << std::setfill(' '), line.margin_, line.lines_, line.ends_,
+                                line.hbox_->geometry().sizes,
                                 std::make_index_sequence<sizeof...(Blocks) - 1>()) << std::setfill(fill);
     }
 } /* namespace detail */
@@ -1298,8 +1442,7 @@ public:
         {}
 
     Size size() const {
-        return size_impl(std::make_index_sequence<sizeof...(Blocks)>()) +
-            Size(margin_*(sizeof...(Blocks) - 1), 0);
+        return geometry().size;
     }
 
     const_iterator begin() const {
@@ -1320,18 +1463,36 @@ public:
         return { { this, margin_, e, e } };
     }
 
+    // Children are placed left to right, top aligned
+    detail::box_geometry<sizeof...(Blocks)> const& geometry() const {
+        if (geometry_.epoch != detail::layout_epoch<>::value) {
+            geometry_.sizes = sizes(std::make_index_sequence<sizeof...(Blocks)>());
+            geometry_.size = { Coord(margin_*(sizeof...(Blocks) - 1)), 0 };
+
+            Coord x = 0;
+            for (std::size_t i = 0; i < sizeof...(Blocks); ++i) {
+                geometry_.offsets[i] = { x, 0 };
+                x += geometry_.sizes[i].x + margin_;
+                geometry_.size.x += geometry_.sizes[i].x;
+                geometry_.size.y = utils::max(geometry_.size.y, geometry_.sizes[i].y);
+            }
+
+            geometry_.epoch = detail::layout_epoch<>::value;
+        }
+
+        return geometry_;
+    }
+
 private:
+    friend struct detail::layout_compiler;
     friend std::ostream& detail::operator<< <Blocks...>(std::ostream&, value_type const&);
 
     template<std::size_t... N>
-    Size size_impl(std::index_sequence<N...>) const {
-        return {
-            detail::plus_fold(
-                detail::block_traits<std::tuple_element_t<N, decltype(blocks_)>>
-                    ::size(std::get<N>(blocks_)).x...),
-            std::max({ detail::block_traits<std::tuple_element_t<N, decltype(blocks_)>>
-                ::size(std::get<N>(blocks_)).y... }),
-        };
+    std::array<Size, sizeof...(Blocks)> sizes(std::index_sequence<N...>) const {
+        return {{
+            detail::block_traits<std::tuple_element_t<N, decltype(blocks_)>>
+                ::size(std::get<N>(blocks_))...
+        }};
     }
 
     template<std::size_t... N>
@@ -1352,6 +1513,7 @@ private:
 
     std::size_t margin_ = 2;
     std::tuple<Blocks...> blocks_;
+    mutable detail::box_geometry<sizeof...(Blocks)> geometry_;
 };
 
 template<typename Block, typename... Blocks>
@@ -26,16 +26,26 @@
 
 #include "utils.hpp"
 #include "string_view.hpp"
+#include "stats.hpp"
 
 #include "terminal.hpp"
 
 #include "color.hpp"
 #include "colors.hpp"
+#include "colormap.hpp"
 
 #include "point.hpp"
 #include "rect.hpp"
 
 #include "layout.hpp"
+#include "dynamic.hpp"
+#include "screen.hpp"
 
 #include "braille.hpp"
+#include "density.hpp"
+#include "tiled_canvas.hpp"
 #include "real_canvas.hpp"
+#include "autoscale.hpp"
+#include "axes.hpp"
+
+#include "virtual_terminal.hpp"
@@ -30,13 +30,162 @@
 #include "rect.hpp"
 #include "utils.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
+#include <limits>
 #include <type_traits>
+#include <utility>
 
 namespace plot
 {
 
-template<typename Canvas>
+// Axis scales for RealCanvas. A scale maps real coordinates to a space
+// where the mapping to pixels is linear (forward) and back (inverse).
+struct LinearScale {
+    constexpr float forward(float x) const {
+        return x;
+    }
+
+    constexpr float inverse(float y) const {
+        return y;
+    }
+};
+
+// XXX: Non-positive values are clamped to the smallest positive float
+struct Log10Scale {
+    float forward(float x) const {
+        return std::log10(utils::max(x, std::numeric_limits<float>::min()));
+    }
+
+    float inverse(float y) const {
+        return std::pow(10.0f, y);
+    }
+};
+
+// Linear in [-threshold, threshold], logarithmic outside; handles
+// zero and negative values
+struct SymlogScale {
+    constexpr SymlogScale(float linear_threshold = 1.0f)
+        : threshold(linear_threshold)
+        {}
+
+    float forward(float x) const {
+        auto y = std::log10(1.0f + std::abs(x)/threshold);
+        return (x < 0.0f) ? -y : y;
+    }
+
+    float inverse(float y) const {
+        auto x = threshold*(std::pow(10.0f, std::abs(y)) - 1.0f);
+        return (y < 0.0f) ? -x : x;
+    }
+
+    float threshold;
+};
+
+// User defined scale given as a pair of functions
+struct CustomScale {
+    static float identity(float x) {
+        return x;
+    }
+
+    constexpr CustomScale(float (*fwd)(float) = identity, float (*inv)(float) = identity)
+        : forward_fn(fwd), inverse_fn(inv)
+        {}
+
+    float forward(float x) const {
+        return forward_fn(x);
+    }
+
+    float inverse(float y) const {
+        return inverse_fn(y);
+    }
+
+    float (*forward_fn)(float);
+    float (*inverse_fn)(float);
+};
+
+namespace detail
+{
+    // Largest magnitude of mapped coordinates (2^30 with a 64-bit Coord).
+    // Far outside any canvas, yet products of two coordinate differences,
+    // as computed by line rasterization, do not overflow.
+    constexpr Coord coord_limit = Coord(1) << (std::numeric_limits<Coord>::digits/2 - 1);
+
+    // Same as std::lround (halfway cases away from zero) for any value
+    // that fits a pixel coordinate, but inlined: std::lround is usually
+    // a library call, and dominates the cost of map().
+    // Converting NaN, infinities or out of range values to an integer is
+    // undefined: they are clamped to +-coord_limit instead, NaN to the
+    // negative side.
+    inline Coord round_coord(float x) {
+        constexpr double limit = double(coord_limit);
+
+        // Branch-free: copysign, and min/max instructions, which pick
+        // their second argument when the first one is NaN
+        auto r = double(x) + std::copysign(0.5, double(x));
+        return Coord(std::min(limit, std::max(-limit, r)));
+    }
+
+    // Affine map from scaled real coordinates to pixels: (p - origin)*scale
+    struct real_transform {
+        void invalidate() {
+            canvas = { -1, -1 };
+        }
+
+        Size canvas{ -1, -1 };
+        Pointf origin;
+        Sizef scale, inv_scale;
+    };
+
+    // Map real points to pixels on dereference, with factors
+    // fixed at construction
+    template<typename Point, typename XScale, typename YScale, typename Iterator>
+    class mapped_point_iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Point;
+        using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+        using pointer = Point const*;
+        using reference = Point;
+
+        mapped_point_iterator(real_transform const& t, XScale const& xs, YScale const& ys, Iterator it)
+            : t_(t), x_scale_(xs), y_scale_(ys), it_(std::move(it))
+            {}
+
+        reference operator*() const {
+            Pointf p = *it_;
+            return {
+                round_coord((x_scale_.forward(p.x) - t_.origin.x)*t_.scale.x),
+                round_coord((y_scale_.forward(p.y) - t_.origin.y)*t_.scale.y)
+            };
+        }
+
+        mapped_point_iterator& operator++() {
+            ++it_;
+            return *this;
+        }
+
+        bool operator==(mapped_point_iterator const& other) const {
+            return it_ == other.it_;
+        }
+
+        bool operator!=(mapped_point_iterator const& other) const {
+            return it_ != other.it_;
+        }
+
+    private:
+        real_transform t_;
+        XScale x_scale_;
+        YScale y_scale_;
+        Iterator it_;
+    };
+} /* namespace detail */
+
+// Map real coordinates in bounds() to pixels of a canvas. Each axis goes
+// through a scale policy first; with the default LinearScale the mapping
+// is a plain affine transform.
+template<typename Canvas, typename XScale = LinearScale, typename YScale = LinearScale>
 class RealCanvas
 {
 public:
@@ -73,13 +222,39 @@ public:
     }
 
     void bounds(Rectf bnds) {
+        if (bnds == bounds_)
+            return;
+
         bounds_ = bnds;
+        transform_.invalidate();
+
+        // Blocks decorating the canvas (e.g. Axes tick labels)
+        // may change size with the bounds
+        invalidate_layout();
     }
 
     Sizef size() const {
         return bounds_.size();
     }
 
+    XScale const& x_scale() const {
+        return x_scale_;
+    }
+
+    void x_scale(XScale scale) {
+        x_scale_ = scale;
+        transform_.invalidate();
+    }
+
+    YScale const& y_scale() const {
+        return y_scale_;
+    }
+
+    void y_scale(YScale scale) {
+        y_scale_ = scale;
+        transform_.invalidate();
+    }
+
     RealCanvas& push() {
         canvas_.push();
         return *this;
@@ -101,6 +276,7 @@ public:
     RealCanvas& resize(Rectf bnds, Size&& sz) {
         canvas_.resize(std::forward<Size>(sz));
         bounds_ = bnds;
+        transform_.invalidate();
         return *this;
     }
 
@@ -153,14 +329,11 @@ public:
 
     template<typename Iterator, typename... Args>
     RealCanvas& path(Color const& color, Iterator first, Iterator last, Args&&... args) {
-        push();
-        auto start = *first;
-        while (++first != last) {
-            auto end = *first;
-            line(color, start, end);
-            start = end;
-        }
-        return pop(std::forward<Args>(args)...);
+        using mapped = detail::mapped_point_iterator<typename Canvas::point_type, XScale, YScale, Iterator>;
+        auto const& t = transform();
+        canvas_.path(color, mapped(t, x_scale_, y_scale_, first),
+                     mapped(t, x_scale_, y_scale_, last), std::forward<Args>(args)...);
+        return *this;
     }
 
     template<typename... Args>
@@ -168,6 +341,34 @@ public:
         return path(color, points.begin(), points.end(), std::forward<Args>(args)...);
     }
 
+    // Set one pixel per point, see BrailleCanvas::scatter(). Points are
+    // mapped on the fly; non-finite and out of range points are skipped.
+    // XXX: With 500k points on 80x24 cells this is about 5x faster than
+    // XXX: a dot() loop, short of the 10x that was aimed for: most of the
+    // XXX: remaining time goes to reading and mapping input points.
+    template<typename Iterator, typename... Args>
+    RealCanvas& scatter(Color const& color, Iterator first, Iterator last, Args&&... args) {
+        using mapped = detail::mapped_point_iterator<typename Canvas::point_type, XScale, YScale, Iterator>;
+        auto const& t = transform();
+        canvas_.scatter(color, mapped(t, x_scale_, y_scale_, first),
+                        mapped(t, x_scale_, y_scale_, last), std::forward<Args>(args)...);
+        return *this;
+    }
+
+    template<typename... Args>
+    RealCanvas& scatter(Color const& color, std::initializer_list<Pointf> const& points, Args&&... args) {
+        return scatter(color, points.begin(), points.end(), std::forward<Args>(args)...);
+    }
+
+    // Add points to canvases that accumulate them, e.g. DensityCanvas
+    template<typename Iterator>
+    RealCanvas& add(Iterator first, Iterator last) {
+        using mapped = detail::mapped_point_iterator<typename Canvas::point_type, XScale, YScale, Iterator>;
+        auto const& t = transform();
+        canvas_.add(mapped(t, x_scale_, y_scale_, first), mapped(t, x_scale_, y_scale_, last));
+        return *this;
+    }
+
     template<typename... Args>
     RealCanvas& rect(Color const& color, Rectf const& rct, Args&&... args) {
         canvas_.rect(color, map(rct), std::forward<Args>(args)...);
@@ -204,12 +405,17 @@ public:
         return *this;
     }
 
+    template<typename... Args>
+    RealCanvas& text(Color const& color, Pointf p, Args&&... args) {
+        canvas_.text(color, map(p), std::forward<Args>(args)...);
+        return *this;
+    }
+
     typename Canvas::point_type map(Pointf const& p) const {
-        auto canvas_bounds = canvas_.size();
-        canvas_bounds -= decltype(canvas_bounds){ 1, 1 };
+        auto const& t = transform();
         return {
-            std::lround((p.x - bounds_.p1.x)/(bounds_.p2.x - bounds_.p1.x) * canvas_bounds.x),
-            std::lround((p.y - bounds_.p1.y)/(bounds_.p2.y - bounds_.p1.y) * canvas_bounds.y)
+            detail::round_coord((x_scale_.forward(p.x) - t.origin.x)*t.scale.x),
+            detail::round_coord((y_scale_.forward(p.y) - t.origin.y)*t.scale.y)
         };
     }
 
@@ -217,22 +423,34 @@ public:
         return { map(r.p1), map(r.p2) };
     }
 
+    // Map a sequence of points to pixel coordinates
+    template<typename InputIterator, typename OutputIterator>
+    OutputIterator map(InputIterator first, InputIterator last, OutputIterator out) const {
+        auto const t = transform();
+        for (; first != last; ++first, ++out) {
+            Pointf p = *first;
+            *out = typename Canvas::point_type{
+                detail::round_coord((x_scale_.forward(p.x) - t.origin.x)*t.scale.x),
+                detail::round_coord((y_scale_.forward(p.y) - t.origin.y)*t.scale.y)
+            };
+        }
+        return out;
+    }
+
+    // XXX: With non-linear scales, sizes are measured in scaled units
     typename Canvas::size_type map_size(Sizef const& s) const {
-        auto sz = this->size();
-        auto canvas_bounds = canvas_.size();
-        canvas_bounds -= decltype(canvas_bounds){ 1, 1 };
+        auto const& t = transform();
         return {
-            std::lround(s.x/sz.x * canvas_bounds.x),
-            std::lround(s.y/sz.y * canvas_bounds.y)
+            detail::round_coord(s.x*std::abs(t.scale.x)),
+            detail::round_coord(s.y*std::abs(t.scale.y))
         };
     }
 
     Pointf unmap(typename Canvas::point_type const& p) const {
-        auto canvas_bounds = canvas_.size();
-        canvas_bounds -= decltype(canvas_bounds){ 1, 1 };
+        auto const& t = transform();
         return {
-            (float(p.x)/canvas_bounds.x)*(bounds_.p2.x - bounds_.p1.x) + bounds_.p1.x,
-            (float(p.y)/canvas_bounds.y)*(bounds_.p2.y - bounds_.p1.y) + bounds_.p1.y
+            x_scale_.inverse(float(p.x)*t.inv_scale.x + t.origin.x),
+            y_scale_.inverse(float(p.y)*t.inv_scale.y + t.origin.y)
         };
     }
 
@@ -240,45 +458,83 @@ public:
         return { unmap(r.p1), unmap(r.p2) };
     }
 
+    // Map a sequence of pixel coordinates to real points
+    template<typename InputIterator, typename OutputIterator>
+    OutputIterator unmap(InputIterator first, InputIterator last, OutputIterator out) const {
+        auto const t = transform();
+        for (; first != last; ++first, ++out) {
+            typename Canvas::point_type p = *first;
+            *out = Pointf(x_scale_.inverse(float(p.x)*t.inv_scale.x + t.origin.x),
+                          y_scale_.inverse(float(p.y)*t.inv_scale.y + t.origin.y));
+        }
+        return out;
+    }
+
+    // XXX: With non-linear scales, sizes are measured in scaled units
     Sizef unmap_size(typename Canvas::size_type const& s) const {
-        auto sz = this->size();
-        auto canvas_bounds = canvas_.size();
-        canvas_bounds -= decltype(canvas_bounds){ 1, 1 };
+        auto const& t = transform();
         return {
-            float(s.x)/canvas_bounds.x * sz.x,
-            float(s.y)/canvas_bounds.y * sz.y
+            float(s.x)*std::abs(t.inv_scale.x),
+            float(s.y)*std::abs(t.inv_scale.y)
         };
     }
 
 private:
+    // Scale and offset factors are recomputed only when bounds
+    // or canvas size change
+    detail::real_transform const& transform() const {
+        auto sz = canvas_.size();
+        if (transform_.canvas != sz) {
+            Sizef pixels(float(sz.x - 1), float(sz.y - 1));
+            Pointf p1(x_scale_.forward(bounds_.p1.x), y_scale_.forward(bounds_.p1.y));
+            Pointf p2(x_scale_.forward(bounds_.p2.x), y_scale_.forward(bounds_.p2.y));
+            auto range = p2 - p1;
+
+            transform_.canvas = sz;
+            transform_.origin = p1;
+            transform_.scale = { pixels.x/range.x, pixels.y/range.y };
+            transform_.inv_scale = { range.x/pixels.x, range.y/pixels.y };
+        }
+
+        return transform_;
+    }
+
     Rectf bounds_{ { 0.0f, 1.0f }, { 1.0f, 0.0f } };
     Canvas canvas_;
+    XScale x_scale_;
+    YScale y_scale_;
+    mutable detail::real_transform transform_;
 };
 
-template<typename Canvas>
-inline std::ostream& operator<<(std::ostream& stream, RealCanvas<Canvas> const& canvas) {
+template<typename Canvas, typename XScale, typename YScale>
+inline std::ostream& operator<<(std::ostream& stream, RealCanvas<Canvas, XScale, YScale> const& canvas) {
     return stream << canvas.canvas();
 }
 
 namespace detail
 {
     // Make RealCanvas a valid block
-    template<typename Canvas, bool IsCanvas>
-    struct block_ref_traits<plot::RealCanvas<Canvas>, IsCanvas>
+    template<typename Canvas, typename XScale, typename YScale, bool IsCanvas>
+    struct block_ref_traits<plot::RealCanvas<Canvas, XScale, YScale>, IsCanvas>
     {
         using iterator = typename Canvas::const_iterator;
 
-        static Size size(plot::RealCanvas<Canvas> const& block) {
+        static Size size(plot::RealCanvas<Canvas, XScale, YScale> const& block) {
             return block.canvas().char_size();
         }
 
-        static iterator begin(plot::RealCanvas<Canvas> const& block) {
+        static iterator begin(plot::RealCanvas<Canvas, XScale, YScale> const& block) {
             return block.canvas().begin();
         }
 
-        static iterator end(plot::RealCanvas<Canvas> const& block) {
+        static iterator end(plot::RealCanvas<Canvas, XScale, YScale> const& block) {
             return block.canvas().end();
         }
+
+        static bool resize(plot::RealCanvas<Canvas, XScale, YScale>& block, Size sz) {
+            block.resize(sz);
+            return true;
+        }
     };
 } /* namespace detail */
 
@@ -0,0 +1,368 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "layout.hpp"
+#include "point.hpp"
+#include "rect.hpp"
+#include "terminal.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace plot
+{
+
+namespace detail
+{
+    // Stream buffer appending output to a string. Used to capture block
+    // lines while reusing string storage across frames.
+    class string_sink : public std::streambuf
+    {
+    public:
+        void target(std::string& str) {
+            str.clear();
+            str_ = &str;
+        }
+
+    protected:
+        int_type overflow(int_type ch) override {
+            if (!traits_type::eq_int_type(ch, traits_type::eof()))
+                str_->push_back(traits_type::to_char_type(ch));
+            return traits_type::not_eof(ch);
+        }
+
+        std::streamsize xsputn(char_type const* s, std::streamsize count) override {
+            str_->append(s, count);
+            return count;
+        }
+
+    private:
+        std::string* str_ = nullptr;
+    };
+
+    // A screen area filled with the lines of a single block
+    struct screen_region
+    {
+        using draw_fn = std::function<void(std::ostream&, string_sink&, std::vector<std::string>&)>;
+
+        screen_region(Rect r, draw_fn fn)
+            : rect(r), draw(std::move(fn)), lines(r.size().y), previous(r.size().y)
+            {}
+
+        Rect rect;
+        draw_fn draw;
+        std::vector<std::string> lines, previous;
+    };
+
+    // Flatten a layout tree into a list of leaf regions.
+    // Container blocks are decomposed; any other block is a leaf.
+    struct layout_compiler
+    {
+        using regions = std::vector<screen_region>;
+
+        template<typename Block>
+        static void compile(regions& out, Point origin, Block const& block) {
+            Block const* ptr = &block;
+            out.emplace_back(Rect(origin, origin + block_traits<Block>::size(block)),
+                [ptr](std::ostream& stream, string_sink& sink, std::vector<std::string>& lines) {
+                    auto it = block_traits<Block>::begin(*ptr);
+                    auto end = block_traits<Block>::end(*ptr);
+                    for (auto ln = lines.begin(); it != end && ln != lines.end(); ++it, ++ln) {
+                        sink.target(*ln);
+                        stream << *it;
+                    }
+                });
+        }
+
+        template<typename Block>
+        static void compile(regions& out, Point origin, Block* const& block) {
+            compile(out, origin, *block);
+        }
+
+        template<typename Block>
+        static void compile(regions& out, Point origin, Margin<Block> const& margin) {
+            compile(out, origin + Point(margin.left_, margin.top_), margin.block_);
+        }
+
+        template<typename Block>
+        static void compile(regions& out, Point origin, Alignment<Block> const& alignment) {
+            auto sz = alignment.size();
+            auto block_sz = block_traits<Block>::size(alignment.block_);
+
+            auto hmargin = sz.x - block_sz.x,
+                 vmargin = sz.y - block_sz.y;
+            auto top = (alignment.valign_ == VAlign::Middle) ? vmargin / 2
+                                                             : (alignment.valign_ == VAlign::Bottom) ? vmargin : 0;
+            auto left = (alignment.halign_ == Align::Center) ? hmargin / 2
+                                                             : (alignment.halign_ == Align::Right) ? hmargin : 0;
+
+            compile(out, origin + Point(left, top), alignment.block_);
+        }
+
+        template<typename Block>
+        static void compile(regions& out, Point origin, Frame<Block> const& frame) {
+            auto sz = frame.size();
+            Frame<Block> const* ptr = &frame;
+
+            // Top border and label
+            out.emplace_back(Rect(origin, origin + Size(sz.x, 1)),
+                [ptr](std::ostream& stream, string_sink& sink, std::vector<std::string>& lines) {
+                    sink.target(lines.front());
+                    stream << *ptr->cbegin();
+                });
+
+            // Side borders
+            auto side = [](string_view border, TerminalInfo const& term) {
+                return [border,term](std::ostream& stream, string_sink& sink, std::vector<std::string>& lines) {
+                    for (auto& ln: lines) {
+                        sink.target(ln);
+                        stream << term.reset() << border;
+                    }
+                };
+            };
+
+            out.emplace_back(Rect(origin + Point(0, 1), origin + Point(1, sz.y - 1)),
+                             side(frame.border_.left, frame.term_));
+            out.emplace_back(Rect(origin + Point(sz.x - 1, 1), origin + Point(sz.x, sz.y - 1)),
+                             side(frame.border_.right, frame.term_));
+
+            // Bottom border
+            out.emplace_back(Rect(origin + Point(0, sz.y - 1), origin + sz),
+                [ptr,width=sz.x-2](std::ostream& stream, string_sink& sink, std::vector<std::string>& lines) {
+                    auto const& border = ptr->border_;
+                    sink.target(lines.front());
+                    stream << ptr->term_.reset() << border.bottom_left;
+                    for (Coord i = 0; i < width; ++i)
+                        stream << border.bottom;
+                    stream << border.bottom_right;
+                });
+
+            compile(out, origin + Point(1, 1), frame.block_);
+        }
+
+        template<typename... Blocks>
+        static void compile(regions& out, Point origin, VBox<Blocks...> const& vbox) {
+            compile_children(out, origin, vbox.geometry(), vbox.blocks_,
+                             std::make_index_sequence<sizeof...(Blocks)>());
+        }
+
+        template<typename... Blocks>
+        static void compile(regions& out, Point origin, HBox<Blocks...> const& hbox) {
+            compile_children(out, origin, hbox.geometry(), hbox.blocks_,
+                             std::make_index_sequence<sizeof...(Blocks)>());
+        }
+
+    private:
+        template<typename Geometry, typename Blocks, std::size_t... N>
+        static void compile_children(regions& out, Point origin, Geometry const& geometry,
+                                     Blocks const& blocks, std::index_sequence<N...>) {
+            int expand[] = { 0, (compile(out, origin + geometry.offsets[N], std::get<N>(blocks)), 0)... };
+            (void) expand;
+        }
+    };
+} /* namespace detail */
+
+
+// Full-screen renderer. A layout tree is compiled into a flat list of
+// screen regions, one for each leaf block; each frame, leaf lines are
+// captured into a screen buffer and only the lines that changed since
+// the previous frame are written to the terminal.
+//
+// The screen keeps a reference to the layout: the layout must outlive it,
+// so temporaries are rejected.
+// Layout invalidation triggers recompilation; a full redraw follows
+// only when some region moved or changed size.
+//
+// XXX: Differential updates require cursor positioning; when the terminal
+// XXX: mode is TerminalMode::None, every update is a full redraw.
+class Screen {
+public:
+    template<typename Block>
+    explicit Screen(Block const& block, TerminalInfo term = TerminalInfo(), Point origin = { 1, 1 })
+        : compile_([&block](detail::layout_compiler::regions& out) {
+              detail::layout_compiler::compile(out, {}, block);
+          }),
+          size_([&block]() { return detail::block_traits<Block>::size(block); }),
+          term_(term), origin_(origin), stream_(&sink_)
+        {}
+
+    // Temporaries would not outlive the screen
+    template<typename Block>
+    explicit Screen(Block const&&, TerminalInfo = TerminalInfo(), Point = { 1, 1 }) = delete;
+
+    Screen(Screen const&) = delete;
+    Screen& operator=(Screen const&) = delete;
+
+    // Terminal coordinates (1-based) of the top-left corner
+    Point origin() const {
+        return origin_;
+    }
+
+    Screen& origin(Point loc) {
+        origin_ = loc;
+        epoch_ = 0;
+        return *this;
+    }
+
+    Size size() const {
+        return size_();
+    }
+
+    // Redraw the whole screen
+    Screen& render(std::ostream& stream) {
+        compile();
+        draw();
+        output(stream);
+        return *this;
+    }
+
+    // Write lines changed since the last frame
+    Screen& update(std::ostream& stream) {
+        if (epoch_ == 0 || term_.mode == TerminalMode::None)
+            return render(stream);
+
+        if (epoch_ != detail::layout_epoch<>::value) {
+            auto old = std::move(regions_);
+            compile();
+
+            if (!same_geometry(old)) {
+                draw();
+                output(stream);
+                return *this;
+            }
+
+            // Regions are in place: keep diffing against their last lines
+            for (std::size_t i = 0; i < regions_.size(); ++i)
+                regions_[i].lines.swap(old[i].lines);
+        }
+
+        draw();
+
+        bool changed = false;
+        for (auto& region: regions_) {
+            for (std::size_t i = 0, n = region.lines.size(); i < n; ++i) {
+                if (region.lines[i] != region.previous[i]) {
+                    stream << term_.move_to(origin_ + region.rect.p1 + Point(0, i))
+                           << term_.reset() << region.lines[i];
+                    changed = true;
+                }
+            }
+        }
+
+        if (changed)
+            stream << term_.reset();
+
+        return *this;
+    }
+
+private:
+    void compile() {
+        if (epoch_ == detail::layout_epoch<>::value)
+            return;
+
+        regions_.clear();
+        compile_(regions_);
+
+        // Sort regions by position to compose full rows
+        std::sort(regions_.begin(), regions_.end(), [](auto const& r1, auto const& r2) {
+            return r1.rect.p1.x < r2.rect.p1.x;
+        });
+
+        rows_.assign(size_().y, {});
+        for (std::size_t i = 0; i < regions_.size(); ++i) {
+            auto const& rect = regions_[i].rect;
+            for (auto y = utils::max(Coord(0), rect.p1.y), end = utils::min(Coord(rows_.size()), rect.p2.y); y < end; ++y)
+                rows_[y].push_back({ i, std::size_t(y - rect.p1.y) });
+        }
+
+        epoch_ = detail::layout_epoch<>::value;
+    }
+
+    bool same_geometry(detail::layout_compiler::regions const& old) const {
+        if (old.size() != regions_.size())
+            return false;
+
+        for (std::size_t i = 0; i < old.size(); ++i) {
+            if (old[i].rect != regions_[i].rect)
+                return false;
+        }
+
+        return true;
+    }
+
+    void draw() {
+        for (auto& region: regions_) {
+            region.lines.swap(region.previous);
+            region.draw(stream_, sink_, region.lines);
+        }
+    }
+
+    void output(std::ostream& stream) {
+        bool positioning = term_.mode != TerminalMode::None;
+        auto width = size_().x;
+
+        for (std::size_t y = 0; y < rows_.size(); ++y) {
+            if (positioning)
+                stream << term_.move_to(origin_ + Point(0, y));
+            else if (y)
+                stream << '\n';
+
+            Coord x = 0;
+            for (auto const& seg: rows_[y]) {
+                auto const& region = regions_[seg.first];
+                for (; x < region.rect.p1.x; ++x)
+                    stream << ' ';
+                stream << region.lines[seg.second];
+                x = region.rect.p2.x;
+            }
+
+            for (; x < width; ++x)
+                stream << ' ';
+
+            stream << term_.reset();
+        }
+    }
+
+    std::function<void(detail::layout_compiler::regions&)> compile_;
+    std::function<Size()> size_;
+    TerminalInfo term_;
+    Point origin_;
+
+    std::size_t epoch_ = 0;
+    detail::layout_compiler::regions regions_;
+    std::vector<std::vector<std::pair<std::size_t, std::size_t>>> rows_;
+
+    detail::string_sink sink_;
+    std::ostream stream_;
+};
+
+} /* namespace plot */
@@ -0,0 +1,109 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+// Render statistics are collected only when PLOT_ENABLE_STATS is defined
+// before including plot headers. Otherwise counters and timers compile
+// to nothing and statistics stay zero.
+//
+// Entities whose definitions depend on the setting (the counters and
+// timers, and the canvases using them) are declared in an inline namespace
+// named after it. Translation units built with and without statistics
+// thus get distinct entities instead of violating the ODR, and passing
+// a canvas from one to the other fails to link.
+#ifdef PLOT_ENABLE_STATS
+#define PLOT_STATS_NAMESPACE stats_on
+#else
+#define PLOT_STATS_NAMESPACE stats_off
+#endif
+
+namespace plot
+{
+
+struct RenderStats {
+    using duration = std::chrono::nanoseconds;
+
+    std::uint64_t cells_painted = 0;    // Cells written by drawing operations
+    std::uint64_t layers_pushed = 0;
+    std::uint64_t layers_popped = 0;
+    std::uint64_t lines_rendered = 0;
+    std::uint64_t escapes = 0;          // Color SGR sequences written
+    std::uint64_t bytes = 0;            // Bytes of cell content written
+
+    duration draw_time{ 0 };            // Rasterization of drawing operations
+    duration compose_time{ 0 };         // Layer compositing on pop()
+    duration render_time{ 0 };          // Color quantization and line encoding
+    duration write_time{ 0 };           // Writing encoded lines to the stream
+
+    void clear() {
+        *this = RenderStats();
+    }
+};
+
+namespace detail { inline namespace PLOT_STATS_NAMESPACE
+{
+#ifdef PLOT_ENABLE_STATS
+    inline void stats_add(std::uint64_t& counter, std::uint64_t n = 1) {
+        counter += n;
+    }
+
+    // Adds the time elapsed between construction and destruction
+    // to a duration
+    class stats_timer {
+    public:
+        explicit stats_timer(RenderStats::duration& total)
+            : total_(total), start_(clock::now())
+            {}
+
+        stats_timer(stats_timer const&) = delete;
+        stats_timer& operator=(stats_timer const&) = delete;
+
+        ~stats_timer() {
+            total_ += std::chrono::duration_cast<RenderStats::duration>(clock::now() - start_);
+        }
+
+    private:
+        using clock = std::chrono::steady_clock;
+
+        RenderStats::duration& total_;
+        clock::time_point start_;
+    };
+#else
+    inline void stats_add(std::uint64_t&, std::uint64_t = 1) {}
+
+    class stats_timer {
+    public:
+        explicit stats_timer(RenderStats::duration&) {}
+
+        stats_timer(stats_timer const&) = delete;
+        stats_timer& operator=(stats_timer const&) = delete;
+    };
+#endif
+} /* inline namespace PLOT_STATS_NAMESPACE */ } /* namespace detail */
+
+} /* namespace plot */
@@ -26,10 +26,13 @@
 
 #include "point.hpp"
 #include "color.hpp"
+#include "color_data.hpp"
 #include "string_view.hpp"
 
+#include <csignal>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <chrono>
 #include <ostream>
 #include <string>
@@ -38,6 +41,7 @@
 
 #if defined(__unix__) || defined(__linux__) || (defined(__APPLE__) && defined(__MACH__))
 #define PLOT_PLATFORM_POSIX
+#include <signal.h>
 #include <termios.h>
 #include <unistd.h>
 #include <sys/ioctl.h>
@@ -95,27 +99,43 @@ namespace ansi
             });
         }
 
+        // Palette matches are looked up in tables indexed by color
+        // quantized to a few bits per channel (see color_data.hpp):
+        // entries hold the perceptually nearest palette index for the
+        // center of their bin. Tables are generated by scripts/color.py.
+        static constexpr std::size_t quantization_bits = color_tables<>::quantization_bits;
+        static constexpr std::size_t quantization_levels = 1 << quantization_bits;
+
+        inline std::size_t quantization_index(plot::Color c) {
+            using utils::clamp;
+            auto q = [](float x) {
+                return std::size_t(clamp(x, 0.0f, 1.0f)*(quantization_levels - 1) + 0.5f);
+            };
+
+            return (q(c.r) << (2*quantization_bits)) | (q(c.g) << quantization_bits) | q(c.b);
+        }
+
         inline ansi_color find_color(plot::Color c) {
-            return find_palette_entry(c).second;
+            return palette[color_tables<>::ansi16[quantization_index(c)]].second;
         }
 
         inline std::uint8_t find_color256(plot::Color c) {
-            using utils::clamp;
-            auto ansi_clr = find_palette_entry(c);
-            auto color = c.color32(5);
-            std::uint8_t gray = std::lround(clamp(0.3f*c.r + 0.59f*c.g + 0.11f*c.b, 0.0f, 1.0f)*23);
-
-            auto ansi_dist = ansi_clr.first.distance(c);
-            auto color_dist = plot::Color(color, 5).distance(c);
-            auto gray_dist = plot::Color({ gray, gray, gray, 255 }, 23).distance(c);
-
-            if (color_dist <= gray_dist && color_dist <= ansi_dist) {
-                return 16 + 36*color.r + 6*color.g + color.b;
-            } else if (gray_dist <= ansi_dist) {
-                return gray + 0xe8;
-            } else {
-                return ansi_clr.second.first + 8*ansi_clr.second.second;
-            }
+            return color_tables<>::ansi256[quantization_index(c)];
+        }
+
+        // 4x4 Bayer matrix for ordered dithering
+        static constexpr std::uint8_t bayer4[4][4] = {
+            {  0,  8,  2, 10 },
+            { 12,  4, 14,  6 },
+            {  3, 11,  1,  9 },
+            { 15,  7, 13,  5 }
+        };
+
+        // Offset color by the dithering threshold for the given cell.
+        // spread should be about the distance between palette levels.
+        inline plot::Color dither(plot::Color c, Point cell, float spread) {
+            auto d = spread*((bayer4[cell.y & 3][cell.x & 3] + 0.5f)/16.0f - 0.5f);
+            return { c.r + d, c.g + d, c.b + d, c.a };
         }
 
         struct title_setter
@@ -315,6 +335,22 @@ namespace ansi
 } /* namespace ansi */
 
 
+// Color along with its closest matches in the ANSI palettes, for colors
+// written over and over (e.g. colormap entries): the palette search
+// is done once instead of every time the color is written.
+struct TerminalColor {
+    TerminalColor() = default;
+
+    explicit TerminalColor(Color c)
+        : color(c.color32()), ansi(ansi::detail::find_color(c)), ansi256(ansi::detail::find_color256(c))
+        {}
+
+    Color32 color{ 0, 0, 0, 0 };
+    ansi::detail::ansi_color ansi{ 0, false };
+    std::uint8_t ansi256 = 0;
+};
+
+
 #ifdef PLOT_PLATFORM_POSIX
 
 namespace detail
@@ -376,6 +412,139 @@ namespace detail
                 return stream;
         }
     }
+
+    struct terminal_color_setter
+    {
+        TerminalMode mode;
+        TerminalColor color;
+        bool background;
+    };
+
+    inline std::ostream& operator<<(std::ostream& stream, terminal_color_setter const& setter) {
+        switch (setter.mode) {
+            case TerminalMode::Ansi:
+                if (setter.background)
+                    return stream << ansi::detail::background_setter{ setter.color.ansi };
+                return stream << ansi::detail::foreground_setter{ setter.color.ansi };
+            case TerminalMode::Ansi256:
+                if (setter.background)
+                    return stream << ansi::detail::background_setter_256{ setter.color.ansi256 };
+                return stream << ansi::detail::foreground_setter_256{ setter.color.ansi256 };
+            case TerminalMode::Iso24bit:
+                if (setter.background)
+                    return stream << ansi::detail::background_setter_24bit{ setter.color.color };
+                return stream << ansi::detail::foreground_setter_24bit{ setter.color.color };
+            default:
+                return stream;
+        }
+    }
+
+    // Color as written in a given terminal mode: palette index, or packed
+    // RGB in 24-bit mode. Colors with equal codes render the same, so
+    // a run of cells sharing a code needs a single SGR sequence.
+    static constexpr std::uint32_t default_color_code = 0xFFFFFFFFu;
+
+    inline std::uint32_t color_code(TerminalMode mode, Color c) {
+        switch (mode) {
+            case TerminalMode::Ansi:
+                return std::uint32_t(ansi::detail::find_color(c).first);
+            case TerminalMode::Ansi256:
+                return ansi::detail::find_color256(c);
+            case TerminalMode::Iso24bit: {
+                auto c32 = c.color32();
+                return (std::uint32_t(c32.r) << 16) | (std::uint32_t(c32.g) << 8) | c32.b;
+            }
+            default:
+                return 0;
+        }
+    }
+
+    // Longest SGR sequence written by TerminalInfo::append_colors:
+    // 24-bit foreground and background
+    constexpr std::size_t max_colors_length = sizeof(u8"\x1b[38;2;255;255;255;48;2;255;255;255m") - 1;
+
+    // Fixed-size character buffer, with the subset of the std::string
+    // interface used by append_colors. Appends are not bounds checked:
+    // check room() and flush the buffer beforehand.
+    template<std::size_t N>
+    class char_buffer {
+    public:
+        char const* data() const {
+            return data_;
+        }
+
+        std::size_t size() const {
+            return size_;
+        }
+
+        std::size_t room() const {
+            return N - size_;
+        }
+
+        void clear() {
+            size_ = 0;
+        }
+
+        template<std::size_t M>
+        void append(char const (&str)[M]) {
+            append(str, str + M - 1);
+        }
+
+        void append(char const* first, char const* last) {
+            std::memcpy(data_ + size_, first, std::size_t(last - first));
+            size_ += std::size_t(last - first);
+        }
+
+        char_buffer& operator+=(char ch) {
+            data_[size_++] = ch;
+            return *this;
+        }
+
+    private:
+        char data_[N];
+        std::size_t size_ = 0;
+    };
+
+    template<typename Buffer>
+    inline void append_decimal(Buffer& out, std::uint32_t n) {
+        char buf[10];
+        auto p = std::end(buf);
+
+        do {
+            *--p = char('0' + n % 10);
+            n /= 10;
+        } while (n);
+
+        out.append(p, std::end(buf));
+    }
+
+    template<typename Buffer>
+    inline void append_color_params(Buffer& out, TerminalMode mode, std::uint32_t code, bool background) {
+        if (code == default_color_code) {
+            out.append(background ? u8"49" : u8"39");
+            return;
+        }
+
+        switch (mode) {
+            case TerminalMode::Ansi:
+                append_decimal(out, (background ? 40 : 30) + code);
+                break;
+            case TerminalMode::Ansi256:
+                out.append(background ? u8"48;5;" : u8"38;5;");
+                append_decimal(out, code);
+                break;
+            case TerminalMode::Iso24bit:
+                out.append(background ? u8"48;2;" : u8"38;2;");
+                append_decimal(out, code >> 16);
+                out += ';';
+                append_decimal(out, (code >> 8) & 0xFF);
+                out += ';';
+                append_decimal(out, code & 0xFF);
+                break;
+            default:
+                break;
+        }
+    }
 } /* namespace detail */
 
 using Terminal = int;
@@ -492,6 +661,63 @@ public:
         return { mode, c };
     }
 
+    // Apply ordered dithering to a color about to be written to the given
+    // cell, when dithering is enabled and the terminal mode has a limited
+    // palette. The pattern depends only on cell position, so unchanged
+    // content renders identically from one frame to the next.
+    Color dither(Color c, Point cell) const {
+        if (!dithering)
+            return c;
+
+        switch (mode) {
+            case TerminalMode::Ansi:
+                return ansi::detail::dither(c, cell, 0.5f);
+            case TerminalMode::Ansi256:
+                return ansi::detail::dither(c, cell, 0.2f);
+            default:
+                return c;
+        }
+    }
+
+    // Code of a color in the current mode, see detail::color_code
+    std::uint32_t color_code(Color c) const {
+        return detail::color_code(mode, c);
+    }
+
+    // Append to out one SGR sequence switching from color codes (fg0, bg0)
+    // to (fg, bg), setting only what changes. Nothing is appended when
+    // codes match or the mode does not support colors. Out is a std::string
+    // or a detail::char_buffer with room for detail::max_colors_length chars.
+    template<typename Buffer>
+    void append_colors(Buffer& out, std::uint32_t fg, std::uint32_t bg,
+                       std::uint32_t fg0, std::uint32_t bg0) const {
+        bool set_fg = fg != fg0, set_bg = bg != bg0;
+
+        if (!(set_fg || set_bg) || !supported(TerminalMode::Ansi) || mode == TerminalMode::Windows)
+            return;
+
+        out.append(u8"\x1b[");
+
+        if (set_fg)
+            detail::append_color_params(out, mode, fg, false);
+
+        if (set_fg && set_bg)
+            out += ';';
+
+        if (set_bg)
+            detail::append_color_params(out, mode, bg, true);
+
+        out += 'm';
+    }
+
+    detail::terminal_color_setter foreground(TerminalColor const& c) const {
+        return { mode, c, false };
+    }
+
+    detail::terminal_color_setter background(TerminalColor const& c) const {
+        return { mode, c, true };
+    }
+
     auto move_to(Point loc) const {
         return detail::make_ansi_manip_wrapper(mode, ansi::move_to(loc));
     }
@@ -515,6 +741,7 @@ public:
     TerminalMode mode;
     Color foreground_color;
     Color background_color;
+    bool dithering = false;  // Dither colors in Ansi and Ansi256 modes
 
 private:
     template<typename = void>
@@ -681,6 +908,121 @@ std::string TerminalInfo::query(string_view cmd, string_view terminator) {
     return std::string();
 }
 
+
+namespace detail
+{
+    // Template variables struct members should be linked only once
+    // though appearing in multiple translation units
+    template<typename = void>
+    struct winch_state {
+        static volatile std::sig_atomic_t generation;
+        static bool installed;
+        static struct sigaction previous;
+    };
+
+    template<typename T>
+    volatile std::sig_atomic_t winch_state<T>::generation = 0;
+
+    template<typename T>
+    bool winch_state<T>::installed = false;
+
+    template<typename T>
+    struct sigaction winch_state<T>::previous;
+
+    template<typename = void>
+    void winch_handler(int sig, siginfo_t* info, void* context) {
+        winch_state<>::generation = winch_state<>::generation + 1;
+
+        // Chain previously installed handler
+        auto const& prev = winch_state<>::previous;
+        if (prev.sa_flags & SA_SIGINFO) {
+            if (prev.sa_sigaction)
+                prev.sa_sigaction(sig, info, context);
+        } else if (prev.sa_handler != SIG_DFL && prev.sa_handler != SIG_IGN) {
+            prev.sa_handler(sig);
+        }
+    }
+
+    // XXX: This function is not thread-safe
+    template<typename = void>
+    bool install_winch_handler() {
+        if (winch_state<>::installed)
+            return true;
+
+        struct sigaction action;
+        action.sa_sigaction = &winch_handler<>;
+        action.sa_flags = SA_SIGINFO | SA_RESTART;
+        sigemptyset(&action.sa_mask);
+
+        return (winch_state<>::installed = !sigaction(SIGWINCH, &action, &winch_state<>::previous));
+    }
+} /* namespace detail */
+
+
+// Track terminal size changes.
+// The first watcher installs a SIGWINCH handler (chaining the previously
+// installed one, if any) which is never removed. The terminal size
+// is cached and queried again only after a SIGWINCH has been received.
+//
+// XXX: Watchers are not thread-safe
+class SizeWatcher {
+public:
+    explicit SizeWatcher(TerminalInfo term = TerminalInfo())
+        : term_(term)
+    {
+        detail::install_winch_handler();
+        generation_ = detail::winch_state<>::generation;
+        size_ = reported_ = term_.size();
+    }
+
+    TerminalInfo const& terminal() const {
+        return term_;
+    }
+
+    // Current terminal size
+    Size size() {
+        refresh();
+        return size_;
+    }
+
+    // Return true when the terminal size has changed since the last call
+    // to changed() or poll()
+    bool changed() {
+        refresh();
+
+        if (size_ == reported_)
+            return false;
+
+        reported_ = size_;
+        return true;
+    }
+
+    // Invoke fn(size) when the terminal size has changed since the last call
+    // to changed() or poll(). Typically used to resize canvases and redraw
+    // full-screen layouts. Returns true if fn has been invoked.
+    template<typename Fn>
+    bool poll(Fn&& fn) {
+        if (!changed())
+            return false;
+
+        fn(size_);
+        return true;
+    }
+
+private:
+    void refresh() {
+        std::sig_atomic_t generation = detail::winch_state<>::generation;
+        if (generation != generation_) {
+            generation_ = generation;
+            size_ = term_.size();
+        }
+    }
+
+    TerminalInfo term_;
+    std::sig_atomic_t generation_ = 0;
+    Size size_, reported_;
+};
+
 #else
 #error "Non-POSIX systems are not supported"
 #endif
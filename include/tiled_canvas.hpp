@@ -0,0 +1,545 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "braille.hpp"
+#include "color.hpp"
+#include "point.hpp"
+#include "rect.hpp"
+#include "string_view.hpp"
+#include "terminal.hpp"
+#include "utils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace plot
+{
+
+// Braille canvas for very large images, e.g. long histories scrolled
+// through a window. Cells are stored in tiles of tile_cols*tile_lines
+// cells, allocated when a drawing operation first paints on them: empty
+// regions cost a pointer per tile.
+//
+// The drawing API is that of BrailleCanvas. Each operation is forwarded,
+// translated, to the tiles its bounding box overlaps (for lines, to the
+// tiles along them); tiles start at cell boundaries, so results are the
+// same as on a single BrailleCanvas.
+//
+// Tiled canvases are not rendered directly: view() copies a window into
+// a BrailleCanvas, whose background and terminal settings apply.
+inline namespace PLOT_STATS_NAMESPACE {
+
+class TiledCanvas {
+public:
+    constexpr static uint8_t cell_cols = BrailleCanvas::cell_cols;
+    constexpr static uint8_t cell_rows = BrailleCanvas::cell_rows;
+
+    // Tile size in cells
+    constexpr static Coord tile_cols = 64;
+    constexpr static Coord tile_lines = 16;
+
+    using coord_type = Coord;
+    using point_type = Point;
+    using size_type = Size;
+    using rect_type = Rect;
+
+    TiledCanvas() = default;
+
+    TiledCanvas(Size char_sz)
+        : lines_(std::size_t(char_sz.y)), cols_(std::size_t(char_sz.x)),
+          grid_(grid_size(char_sz)), tiles_(std::size_t(grid_.x*grid_.y))
+        {}
+
+    Size char_size() const {
+        return { Coord(cols_), Coord(lines_) };
+    }
+
+    Size size() const {
+        return { Coord(cell_cols*cols_), Coord(cell_rows*lines_) };
+    }
+
+    // Number of tiles currently allocated
+    std::size_t allocated_tiles() const {
+        return std::size_t(std::count_if(tiles_.begin(), tiles_.end(), [](auto const& t) {
+            return bool(t);
+        }));
+    }
+
+    // Copy the window of viewport's size starting at cell origin into the
+    // top layer of viewport. Cells outside the canvas are left empty.
+    BrailleCanvas& view(BrailleCanvas& viewport, Point origin) const;
+
+    TiledCanvas& push() {
+        ++depth_;
+        for (auto& t: tiles_)
+            if (t)
+                t->push();
+        return *this;
+    }
+
+    TiledCanvas& pop(TerminalOp op = TerminalOp::Over) {
+        if (depth_) {
+            --depth_;
+            for (auto& t: tiles_)
+                if (t)
+                    t->pop(op);
+        }
+        return *this;
+    }
+
+    TiledCanvas& resize(Size sz);
+
+    TiledCanvas& clear() {
+        for (auto& t: tiles_)
+            if (t)
+                t->clear();
+        return *this;
+    }
+
+    TiledCanvas& clear(Rect rct) {
+        return each_tile(rct, [rct](BrailleCanvas& t, Point origin) {
+            t.clear(rct - origin);
+        });
+    }
+
+    // Release tiles left empty, e.g. by clear(). Only done when no layers
+    // are pushed: layers are not tracked per tile.
+    TiledCanvas& shrink_to_fit();
+
+    template<typename Fn>
+    TiledCanvas& stroke(Color const& color, Rect rct, Fn&& fn, TerminalOp op = TerminalOp::Over) {
+        return each_tile(rct, [&](BrailleCanvas& t, Point origin) {
+            t.stroke(color, rct - origin, [&fn,origin](Coord x) {
+                auto ybounds = fn(x + origin.x);
+                return std::make_pair(Coord(ybounds.first - origin.y), Coord(ybounds.second - origin.y));
+            }, op);
+        });
+    }
+
+    template<typename Fn>
+    TiledCanvas& fill(Color const& color, Rect rct, Fn&& fn, TerminalOp op = TerminalOp::Over) {
+        return each_tile(rct, [&](BrailleCanvas& t, Point origin) {
+            t.fill(color, rct - origin, [&fn,origin](Point p) {
+                return fn(p + origin);
+            }, op);
+        });
+    }
+
+    TiledCanvas& fill_backgrounds(bool enable) {
+        fill_backgrounds_ = enable;
+        for (auto& t: tiles_)
+            if (t)
+                t->fill_backgrounds(enable);
+        return *this;
+    }
+
+    bool fill_backgrounds() const {
+        return fill_backgrounds_;
+    }
+
+    TiledCanvas& dot(Color const& color, Point p, TerminalOp op = TerminalOp::Over) {
+        return each_tile({ p, p }, [&](BrailleCanvas& t, Point origin) {
+            t.dot(color, p - origin, op);
+        });
+    }
+
+    template<typename Iterator>
+    TiledCanvas& scatter(Color const& color, Iterator first, Iterator last, TerminalOp op = TerminalOp::Over);
+
+    TiledCanvas& scatter(Color const& color, std::initializer_list<Point> const& points, TerminalOp op = TerminalOp::Over) {
+        return scatter(color, points.begin(), points.end(), op);
+    }
+
+    TiledCanvas& line(Color const& color, Point from, Point to, TerminalOp op = TerminalOp::Over) {
+        return each_line_tile(from, to, [&](BrailleCanvas& t, Point origin) {
+            t.line(color, from - origin, to - origin, op);
+        });
+    }
+
+    template<typename Iterator>
+    TiledCanvas& path(Color const& color, Iterator first, Iterator last, TerminalOp op = TerminalOp::Over);
+
+    TiledCanvas& path(Color const& color, std::initializer_list<Point> const& points, TerminalOp op = TerminalOp::Over) {
+        return path(color, points.begin(), points.end(), op);
+    }
+
+    // Segments as in BrailleCanvas::rect(): tiles inside the outline
+    // are not visited
+    TiledCanvas& rect(Color const& color, Rect const& rct, TerminalOp op = TerminalOp::Over) {
+        shape_line(color, rct.p1, { rct.p2.x, rct.p1.y });
+        shape_line(color, rct.p1, { rct.p1.x, rct.p2.y });
+        shape_line(color, rct.p2, { rct.p2.x, rct.p1.y });
+        shape_line(color, rct.p2, { rct.p1.x, rct.p2.y });
+        return end_shapes(op);
+    }
+
+    TiledCanvas& rect(Color const& stroke_color, Color const& fill_color, Rect const& rct, TerminalOp op = TerminalOp::Over) {
+        return each_tile(rct, [&](BrailleCanvas& t, Point origin) {
+            t.rect(stroke_color, fill_color, rct - origin, op);
+        });
+    }
+
+    TiledCanvas& ellipse(Color const& color, Rect const& rct, TerminalOp op = TerminalOp::Over) {
+        return each_tile(rct, [&](BrailleCanvas& t, Point origin) {
+            t.ellipse(color, rct - origin, op);
+        });
+    }
+
+    TiledCanvas& ellipse(Color const& stroke_color, Color const& fill_color, Rect const& rct, TerminalOp op = TerminalOp::Over) {
+        return each_tile(rct, [&](BrailleCanvas& t, Point origin) {
+            t.ellipse(stroke_color, fill_color, rct - origin, op);
+        });
+    }
+
+    TiledCanvas& ellipse(Color const& stroke_color, Point const& center, Size const& semiaxes, TerminalOp op = TerminalOp::Over) {
+        return ellipse(stroke_color, { center - semiaxes, center + semiaxes }, op);
+    }
+
+    TiledCanvas& ellipse(Color const& stroke_color, Color const& fill_color, Point const& center, Size const& semiaxes, TerminalOp op = TerminalOp::Over) {
+        return ellipse(stroke_color, fill_color, { center - semiaxes, center + semiaxes }, op);
+    }
+
+    TiledCanvas& text(Color const& color, Point p, string_view str, TerminalOp op = TerminalOp::Over) {
+        auto sz = BrailleCanvas::text_size(str);
+        if (!sz.x)
+            return *this;
+
+        return each_tile({ p, p + sz - Point(1, 1) }, [&](BrailleCanvas& t, Point origin) {
+            t.text(color, p - origin, str, op);
+        });
+    }
+
+    static Size text_size(string_view str) {
+        return BrailleCanvas::text_size(str);
+    }
+
+private:
+    // Tile size in pixels
+    constexpr static Coord tile_width = tile_cols*cell_cols;
+    constexpr static Coord tile_height = tile_lines*cell_rows;
+
+    static Size grid_size(Size char_sz) {
+        return { (char_sz.x + tile_cols - 1)/tile_cols, (char_sz.y + tile_lines - 1)/tile_lines };
+    }
+
+    // Size in cells of tile (tx, ty): tiles on the right
+    // and bottom edges are cut to the canvas size
+    Size tile_size(Coord tx, Coord ty) const {
+        return {
+            utils::min(tile_cols, Coord(cols_) - tx*tile_cols),
+            utils::min(tile_lines, Coord(lines_) - ty*tile_lines)
+        };
+    }
+
+    // Tile (tx, ty), allocated on first use
+    BrailleCanvas& tile(Coord tx, Coord ty);
+
+    // Empty canvas with the size and layers of tile (tx, ty), drawn on
+    // in place of the tile until it is painted on
+    BrailleCanvas& spare(Coord tx, Coord ty);
+
+    // Whether nothing was painted on a tile, shapes in progress included
+    static bool blank(BrailleCanvas const& t) {
+        return t.shape_cells_.empty() && std::all_of(t.blocks_.begin(), t.blocks_.end(), [](auto const& block) {
+            return block.empty();
+        });
+    }
+
+    // Call fn(tile, origin) for each tile overlapping rct, with origin
+    // the position of the tile in pixels. rct includes its bottom-right
+    // corner, as with drawing operations. Tiles not allocated yet are
+    // allocated only if fn paints on them.
+    template<typename Fn>
+    TiledCanvas& each_tile(Rect rct, Fn&& fn);
+
+    // Same as each_tile() for the tiles a line from..to may paint on:
+    // its bounding box, narrowed down for each row of tiles
+    template<typename Fn>
+    TiledCanvas& each_line_tile(Point from, Point to, Fn&& fn);
+
+    // Paths and rectangles are composited as a whole: each tile they
+    // touch collects their segments in a shape, composited by
+    // end_shapes() once all are drawn
+    TiledCanvas& shape_line(Color const& color, Point from, Point to) {
+        return each_line_tile(from, to, [&](BrailleCanvas& t, Point origin) {
+            if (!t.shape_depth_) {
+                t.begin_shape();
+                shape_tiles_.push_back(&t);
+            }
+
+            t.line(color, from - origin, to - origin, TerminalOp::Over);
+        });
+    }
+
+    TiledCanvas& end_shapes(TerminalOp op) {
+        for (auto t: shape_tiles_)
+            t->end_shape(op);
+
+        shape_tiles_.clear();
+        return *this;
+    }
+
+    std::size_t lines_ = 0, cols_ = 0;
+    Size grid_;
+    std::vector<std::unique_ptr<BrailleCanvas>> tiles_;
+    std::unique_ptr<BrailleCanvas> spare_;
+    std::size_t depth_ = 0;
+    bool fill_backgrounds_ = false;
+
+    // Scratch storage for scatter(): points tagged with the index of
+    // their tile. And for path(): tiles in the current shape.
+    std::vector<std::pair<std::size_t, Point>> scatter_points_;
+    std::vector<Point> tile_points_;
+    std::vector<BrailleCanvas*> shape_tiles_;
+};
+
+} /* inline namespace PLOT_STATS_NAMESPACE */
+
+inline BrailleCanvas& TiledCanvas::tile(Coord tx, Coord ty) {
+    auto& t = tiles_[std::size_t(ty*grid_.x + tx)];
+
+    if (!t) {
+        spare(tx, ty);
+        t = std::move(spare_);
+    }
+
+    return *t;
+}
+
+inline BrailleCanvas& TiledCanvas::spare(Coord tx, Coord ty) {
+    if (!spare_)
+        spare_ = std::make_unique<BrailleCanvas>(tile_size(tx, ty));
+    else
+        spare_->resize(tile_size(tx, ty));
+
+    spare_->fill_backgrounds(fill_backgrounds_);
+
+    // Tiles allocated with layers pushed need the same layers.
+    // The spare is empty: popping its layers composites nothing.
+    while (spare_->blocks_.depth() < depth_)
+        spare_->push();
+    while (spare_->blocks_.depth() > depth_)
+        spare_->pop();
+
+    return *spare_;
+}
+
+template<typename Fn>
+TiledCanvas& TiledCanvas::each_tile(Rect rct, Fn&& fn) {
+    rct = rct.sorted();
+
+    auto sz = size();
+    if (rct.p2.x < 0 || rct.p2.y < 0 || rct.p1.x >= sz.x || rct.p1.y >= sz.y)
+        return *this;
+
+    rct = rct.clamp({ { 0, 0 }, sz - Point(1, 1) });
+
+    for (auto ty = rct.p1.y/tile_height; ty <= rct.p2.y/tile_height; ++ty) {
+        for (auto tx = rct.p1.x/tile_width; tx <= rct.p2.x/tile_width; ++tx) {
+            Point origin(tx*tile_width, ty*tile_height);
+            auto& t = tiles_[std::size_t(ty*grid_.x + tx)];
+
+            if (t) {
+                fn(*t, origin);
+                continue;
+            }
+
+            // Draw on the spare: it becomes the tile if painted on,
+            // and is kept for the next tile otherwise
+            auto& s = spare(tx, ty);
+            fn(s, origin);
+
+            if (!blank(s)) {
+                t = std::move(spare_);
+            } else if (s.shape_depth_) {
+                // Drop the shape begun by shape_line()
+                s.end_shape(TerminalOp::Over);
+                shape_tiles_.pop_back();
+            }
+        }
+    }
+
+    return *this;
+}
+
+template<typename Fn>
+TiledCanvas& TiledCanvas::each_line_tile(Point from, Point to, Fn&& fn) {
+    auto sorted = Rect(from, to).sorted_x();
+    auto bounds = Rect(from, to).sorted();
+
+    auto top = utils::max(bounds.p1.y, Coord(0)),
+         bottom = utils::min(bounds.p2.y, size().y - 1);
+
+    if (top/tile_height == bottom/tile_height)
+        return each_tile(bounds, fn);
+
+    // Slope as drawn by BrailleCanvas::line(): columns painted on a row
+    // of tiles lie within one column step of the ideal line's ones.
+    auto dx = double(sorted.p2.x - sorted.p1.x + 1),
+         dy = double(sorted.p2.y - sorted.p1.y);
+    dy += (dy >= 0) - (dy < 0);
+
+    auto step = std::abs(dx/dy) + 2;
+
+    for (auto y = top - top%tile_height; y <= bottom; y += tile_height) {
+        auto y1 = utils::max(y, bounds.p1.y),
+             y2 = utils::min(y + tile_height - 1, bounds.p2.y);
+        auto x1 = sorted.p1.x + (y1 - sorted.p1.y)*dx/dy,
+             x2 = sorted.p1.x + (y2 - sorted.p1.y)*dx/dy;
+
+        Rect band{
+            { utils::max(sorted.p1.x, Coord(std::floor(utils::min(x1, x2) - step))), y1 },
+            { utils::min(sorted.p2.x, Coord(std::ceil(utils::max(x1, x2) + step))), y2 }
+        };
+
+        each_tile(band, fn);
+    }
+
+    return *this;
+}
+
+template<typename Iterator>
+TiledCanvas& TiledCanvas::scatter(Color const& color, Iterator first, Iterator last, TerminalOp op) {
+    // Unsigned comparisons reject negative coordinates too
+    auto width = std::size_t(cell_cols*cols_), height = std::size_t(cell_rows*lines_);
+
+    for (; first != last; ++first) {
+        Point p = *first;
+        if (std::size_t(p.x) >= width || std::size_t(p.y) >= height)
+            continue;
+
+        auto tx = p.x/tile_width, ty = p.y/tile_height;
+        scatter_points_.emplace_back(std::size_t(ty*grid_.x + tx), p);
+    }
+
+    // Scatter points tile by tile: each tile paints each touched cell once
+    std::sort(scatter_points_.begin(), scatter_points_.end(), [](auto const& a, auto const& b) {
+        return a.first < b.first;
+    });
+
+    for (auto it = scatter_points_.begin(), end = scatter_points_.end(); it != end;) {
+        auto index = it->first;
+        Coord tx = Coord(index) % grid_.x, ty = Coord(index) / grid_.x;
+        Point origin(tx*tile_width, ty*tile_height);
+
+        for (; it != end && it->first == index; ++it)
+            tile_points_.push_back(it->second - origin);
+
+        tile(tx, ty).scatter(color, tile_points_.begin(), tile_points_.end(), op);
+        tile_points_.clear();
+    }
+
+    scatter_points_.clear();
+    return *this;
+}
+
+template<typename Iterator>
+TiledCanvas& TiledCanvas::path(Color const& color, Iterator first, Iterator last, TerminalOp op) {
+    Point start = *first;
+    while (++first != last) {
+        Point end_ = *first;
+        shape_line(color, start, end_);
+        start = end_;
+    }
+
+    return end_shapes(op);
+}
+
+inline TiledCanvas& TiledCanvas::resize(Size sz) {
+    if (sz == char_size())
+        return *this;
+
+    auto grid = grid_size(sz);
+    std::vector<std::unique_ptr<BrailleCanvas>> tiles(std::size_t(grid.x*grid.y));
+
+    lines_ = std::size_t(sz.y); cols_ = std::size_t(sz.x);
+
+    // Tiles keep their position: only those on the new
+    // right and bottom edges change size
+    for (Coord ty = 0, rows = utils::min(grid.y, grid_.y); ty < rows; ++ty) {
+        for (Coord tx = 0, cols = utils::min(grid.x, grid_.x); tx < cols; ++tx) {
+            auto& t = tiles_[std::size_t(ty*grid_.x + tx)];
+            if (t) {
+                t->resize(tile_size(tx, ty));
+                tiles[std::size_t(ty*grid.x + tx)] = std::move(t);
+            }
+        }
+    }
+
+    grid_ = grid;
+    tiles_ = std::move(tiles);
+    return *this;
+}
+
+inline TiledCanvas& TiledCanvas::shrink_to_fit() {
+    if (depth_)
+        return *this;
+
+    for (auto& t: tiles_)
+        if (t && blank(*t))
+            t.reset();
+
+    return *this;
+}
+
+inline BrailleCanvas& TiledCanvas::view(BrailleCanvas& viewport, Point origin) const {
+    viewport.clear();
+
+    // Window in cells, clamped to the canvas
+    Rect window{ origin, origin + viewport.char_size() };
+    window = window.clamp({ { 0, 0 }, char_size() });
+
+    if (window.p1.x >= window.p2.x || window.p1.y >= window.p2.y)
+        return viewport;
+
+    for (auto ty = window.p1.y/tile_lines; ty <= (window.p2.y - 1)/tile_lines; ++ty) {
+        for (auto tx = window.p1.x/tile_cols; tx <= (window.p2.x - 1)/tile_cols; ++tx) {
+            auto const& t = tiles_[std::size_t(ty*grid_.x + tx)];
+            if (!t)
+                continue;
+
+            // Part of the window covered by the tile
+            Point tile_origin(tx*tile_cols, ty*tile_lines);
+            auto part = window.clamp({ tile_origin, tile_origin + t->char_size() });
+            auto width = part.p2.x - part.p1.x;
+
+            for (auto ln = part.p1.y; ln < part.p2.y; ++ln) {
+                auto src = t->blocks_.begin() + ((ln - tile_origin.y)*t->char_size().x + part.p1.x - tile_origin.x);
+                auto dst = viewport.blocks_.begin() + ((ln - origin.y)*viewport.char_size().x + part.p1.x - origin.x);
+                std::copy(src, src + width, dst);
+            }
+        }
+    }
+
+    return viewport;
+}
+
+} /* namespace plot */
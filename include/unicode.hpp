@@ -28,13 +28,26 @@
 #include "string_view.hpp"
 
 #include <cstdint>
+#include <cstring>
 #include <limits>
 
+#if !defined(PLOT_NO_SIMD) && defined(__AVX2__)
+    #include <immintrin.h>
+#elif !defined(PLOT_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+    #include <emmintrin.h>
+#endif
+
 namespace plot
 {
 
 namespace detail
 {
+    // Printable ASCII characters have width 1, control characters
+    // (U+0000..U+001F, U+007F) have width 0
+    inline constexpr std::size_t ascii_width(std::uint8_t byte) {
+        return std::uint8_t(byte - 0x20) < 0x5F;
+    }
+
     // For code points in classes Cc, Cf, Cn, Cs, Me, Mn, Zl, Zp,
     // and in range U+1160..U+11FF (Korean combining characters),
     // return width 0.
@@ -44,13 +57,15 @@ namespace detail
     //
     // For all other code points, return 1.
     inline std::size_t wcwidth(char32_t cp) {
-        if (unicode_cp_in_tree(cp, unicode_tables<>::zero_width))
-            return 0;
+        if (cp < 0x80)
+            return ascii_width(std::uint8_t(cp));
 
-        if (unicode_cp_in_tree(cp, unicode_tables<>::double_width))
-            return 2;
+        if (cp > 0x10FFFF)
+            return 1;
 
-        return 1;
+        auto leaf = unicode_tables<>::width_pages[cp >> 8];
+        auto byte = unicode_tables<>::width_leaves[leaf*64 + ((cp & 0xFF) >> 2)];
+        return (byte >> ((cp & 3)*2)) & 3;
     }
 
     constexpr std::uint8_t utf8_start_masks[] = {
@@ -90,10 +105,73 @@ namespace detail
 
     template<typename Iterator>
     inline Iterator utf8_next(Iterator it, Iterator end) {
-        while (it != end && !utf8_seq_start(*++it)) { /* do nothing */ }
+        while (++it != end && !utf8_seq_start(*it)) { /* do nothing */ }
         return it;
     }
 
+    inline unsigned popcount(std::uint32_t x) {
+    #if defined(__GNUC__)
+        return unsigned(__builtin_popcount(x));
+    #else
+        x = x - ((x >> 1) & 0x55555555u);
+        x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+        return unsigned((((x + (x >> 4)) & 0x0F0F0F0Fu)*0x01010101u) >> 24);
+    #endif
+    }
+
+    // Skip whole chunks of ASCII characters, adding their width to width
+    // as long as it does not exceed limit. Returns a pointer to the first
+    // byte not consumed, which might still be ASCII.
+    inline char const* utf8_skip_ascii(char const* first, char const* last,
+                                       std::size_t& width, std::size_t limit) {
+    #if !defined(PLOT_NO_SIMD) && defined(__AVX2__)
+        const __m256i space32 = _mm256_set1_epi8(0x20), del32 = _mm256_set1_epi8(0x7F);
+
+        while (last - first >= 32 && limit - width >= 32) {
+            auto chunk = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(first));
+            if (_mm256_movemask_epi8(chunk))
+                return first;
+
+            // Bytes are known to be positive: signed comparison is safe
+            auto ctrl = _mm256_or_si256(_mm256_cmpgt_epi8(space32, chunk), _mm256_cmpeq_epi8(chunk, del32));
+            width += 32 - popcount(std::uint32_t(_mm256_movemask_epi8(ctrl)));
+            first += 32;
+        }
+    #endif
+
+    #if !defined(PLOT_NO_SIMD) && (defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64))
+        const __m128i space = _mm_set1_epi8(0x20), del = _mm_set1_epi8(0x7F);
+
+        while (last - first >= 16 && limit - width >= 16) {
+            auto chunk = _mm_loadu_si128(reinterpret_cast<__m128i const*>(first));
+            if (_mm_movemask_epi8(chunk))
+                return first;
+
+            auto ctrl = _mm_or_si128(_mm_cmplt_epi8(chunk, space), _mm_cmpeq_epi8(chunk, del));
+            width += 16 - popcount(std::uint32_t(_mm_movemask_epi8(ctrl)));
+            first += 16;
+        }
+    #endif
+
+        // SWAR fallback: eight bytes at a time
+        const std::uint64_t high = 0x8080808080808080u, ones = 0x0101010101010101u;
+
+        while (last - first >= 8 && limit - width >= 8) {
+            std::uint64_t chunk;
+            std::memcpy(&chunk, first, sizeof(chunk));
+            if (chunk & high)
+                return first;
+
+            // No carries between bytes: all of them are below 0x80.
+            // High bit is set for bytes >= 0x20 and not set for 0x7F.
+            auto printable = (chunk + 0x60*ones) & ~(chunk + ones) & high;
+            width += std::size_t(((printable >> 7)*ones) >> 56);
+            first += 8;
+        }
+
+        return first;
+    }
+
     template<typename Iterator>
     inline char32_t utf8_cp(Iterator it, Iterator end) {
         char32_t cp = static_cast<std::uint8_t>(*it);
@@ -104,7 +182,7 @@ namespace detail
 
         cp = (cp & utf8_start_masks[len]);
 
-        while (--len > 0 && it != end && utf8_seq_cont(*++it))
+        while (--len > 0 && ++it != end && utf8_seq_cont(*it))
             cp = (cp << 6) | (static_cast<std::uint8_t>(*it) & utf8_cont_mask);
 
         while (--len > 0)
@@ -118,14 +196,37 @@ template<typename Iterator>
 std::size_t utf8_string_width(Iterator first, Iterator last) {
     std::size_t width = 0;
 
-    for (; first != last; first = detail::utf8_next(first, last))
-        width += detail::wcwidth(detail::utf8_cp(first, last));
+    for (; first != last; first = detail::utf8_next(first, last)) {
+        auto byte = static_cast<std::uint8_t>(*first);
+        width += (byte < 0x80) ? detail::ascii_width(byte)
+                               : detail::wcwidth(detail::utf8_cp(first, last));
+    }
 
     return width;
 }
 
 inline std::size_t utf8_string_width(string_view str) {
-    return utf8_string_width(str.begin(), str.end());
+    std::size_t width = 0;
+    auto first = str.data(), last = str.data() + str.size();
+
+    while (first != last) {
+        first = detail::utf8_skip_ascii(first, last, width, std::numeric_limits<std::size_t>::max());
+        if (first == last)
+            break;
+
+        // Stray bytes after a skipped chunk belong to the last character
+        auto byte = static_cast<std::uint8_t>(*first);
+        if (first != str.data() && !detail::utf8_seq_start(byte)) {
+            first = detail::utf8_next(first, last);
+            continue;
+        }
+
+        width += (byte < 0x80) ? detail::ascii_width(byte)
+                               : detail::wcwidth(detail::utf8_cp(first, last));
+        first = detail::utf8_next(first, last);
+    }
+
+    return width;
 }
 
 template<typename Iterator>
@@ -133,7 +234,9 @@ std::pair<Iterator, std::size_t> utf8_clamp(Iterator first, Iterator last, std::
     std::size_t request = width;
 
     for (; first != last; first = detail::utf8_next(first, last)) {
-        auto cw = detail::wcwidth(detail::utf8_cp(first, last));
+        auto byte = static_cast<std::uint8_t>(*first);
+        auto cw = (byte < 0x80) ? detail::ascii_width(byte)
+                                : detail::wcwidth(detail::utf8_cp(first, last));
         if (cw > width)
             break;
         width -= cw;
@@ -143,8 +246,30 @@ std::pair<Iterator, std::size_t> utf8_clamp(Iterator first, Iterator last, std::
 }
 
 inline std::pair<string_view, std::size_t> utf8_clamp(string_view str, std::size_t width) {
-    auto res = utf8_clamp(str.begin(), str.end(), width);
-    return { string_view(str.begin(), res.first - str.begin()), res.second };
+    std::size_t used = 0;
+    auto first = str.data(), last = str.data() + str.size();
+
+    while (first != last) {
+        first = detail::utf8_skip_ascii(first, last, used, width);
+        if (first == last)
+            break;
+
+        auto byte = static_cast<std::uint8_t>(*first);
+        if (first != str.data() && !detail::utf8_seq_start(byte)) {
+            first = detail::utf8_next(first, last);
+            continue;
+        }
+
+        auto cw = (byte < 0x80) ? detail::ascii_width(byte)
+                                : detail::wcwidth(detail::utf8_cp(first, last));
+        if (cw > width - used)
+            break;
+
+        used += cw;
+        first = detail::utf8_next(first, last);
+    }
+
+    return { string_view(str.data(), std::size_t(first - str.data())), used };
 }
 
 } /* namespace plot */
@@ -0,0 +1,552 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "point.hpp"
+#include "string_view.hpp"
+#include "unicode.hpp"
+#include "utils.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <algorithm>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace plot
+{
+
+// Color attribute of a virtual terminal cell
+struct VirtualColor {
+    enum class Kind : std::uint8_t {
+        Default,    // Terminal default color
+        Indexed,    // Palette index (ANSI and 256 color modes)
+        Rgb         // 24-bit color, packed as 0xRRGGBB
+    };
+
+    Kind kind = Kind::Default;
+    std::uint32_t value = 0;
+
+    bool operator==(VirtualColor const& other) const {
+        return kind == other.kind && value == other.value;
+    }
+
+    bool operator!=(VirtualColor const& other) const {
+        return !(*this == other);
+    }
+};
+
+struct VirtualCell {
+    char32_t glyph = U' ';      // 0 in the right half of wide characters
+    VirtualColor foreground;
+    VirtualColor background;
+    bool bold = false;
+
+    bool operator==(VirtualCell const& other) const {
+        return glyph == other.glyph && foreground == other.foreground &&
+               background == other.background && bold == other.bold;
+    }
+
+    bool operator!=(VirtualCell const& other) const {
+        return !(*this == other);
+    }
+};
+
+// Stream buffer emulating a terminal: text and control sequences written
+// to it are interpreted into a grid of cells. This makes it possible
+// to check what output looks like, independently of how it is encoded:
+//
+//     VirtualTerminal vt({ 80, 24 });
+//     std::ostream stream(&vt);
+//     stream << canvas;
+//     if (!vt.matches(golden)) ...
+//
+// Supported: UTF-8 text with wide characters, CR, LF (as CR+LF), BS, TAB,
+// SGR bold and colors (8, 16, 256 and 24-bit), cursor position and
+// movement (CUP, CUU, CUD, CUF, CUB, CHA), erase in line and display.
+// Other control sequences and OSC strings are consumed and ignored.
+// Writing past the last column wraps; line feeds on the last line
+// scroll the grid.
+class VirtualTerminal : public std::streambuf {
+public:
+    explicit VirtualTerminal(Size sz)
+        : size_(utils::max(sz.x, Coord(1)), utils::max(sz.y, Coord(1))),
+          cells_(std::size_t(size_.x*size_.y))
+        {}
+
+    Size size() const {
+        return size_;
+    }
+
+    Point cursor() const {
+        return cursor_;
+    }
+
+    VirtualCell const& cell(Point p) const {
+        return cells_[std::size_t(p.y*size_.x + p.x)];
+    }
+
+    // Bytes written since construction or the last reset()
+    std::size_t bytes() const {
+        return bytes_;
+    }
+
+    // Control sequences (CSI, OSC and other escapes) received
+    std::size_t escapes() const {
+        return escapes_;
+    }
+
+    // Clear cells, attributes, cursor position and counters
+    void reset() {
+        *this = VirtualTerminal(size_);
+    }
+
+    bool operator==(VirtualTerminal const& other) const {
+        return size_ == other.size_ && cells_ == other.cells_;
+    }
+
+    bool operator!=(VirtualTerminal const& other) const {
+        return !(*this == other);
+    }
+
+    // Number of cells that differ from other; cells outside
+    // the common area count as different
+    std::size_t difference(VirtualTerminal const& other) const;
+
+    // Text dump of the grid, used for golden files: lines of text
+    // (right halves of wide characters omitted), followed by
+    // runs of cells sharing attributes, one per line:
+    //
+    //     <row>:<first column>-<last column> fg=<color> bg=<color>[ bold]
+    //
+    // Colors are written as default, a palette index or #rrggbb.
+    std::string dump() const;
+
+    bool matches(string_view golden) const {
+        auto d = dump();
+        return string_view(d) == golden;
+    }
+
+protected:
+    int_type overflow(int_type ch) override {
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            ++bytes_;
+            put(traits_type::to_char_type(ch));
+        }
+        return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(char const* s, std::streamsize n) override {
+        bytes_ += std::size_t(n);
+        for (auto end = s + n; s != end; ++s)
+            put(*s);
+        return n;
+    }
+
+private:
+    enum class State { Ground, Escape, Csi, Osc, OscEscape };
+
+    VirtualCell& at(Coord x, Coord y) {
+        return cells_[std::size_t(y*size_.x + x)];
+    }
+
+    VirtualCell blank() const {
+        VirtualCell c;
+        c.background = attr_.background;
+        return c;
+    }
+
+    void put(char ch);
+    void print(char32_t cp);
+    void line_feed();
+    void csi(char final);
+    void sgr();
+    void erase(Coord y, Coord from, Coord to);
+
+    Coord param(std::size_t i, Coord def) const {
+        return (i < params_.size() && params_[i]) ? Coord(params_[i]) : def;
+    }
+
+    Size size_;
+    std::vector<VirtualCell> cells_;
+    Point cursor_;
+    VirtualCell attr_;      // Current attributes, glyph unused
+
+    State state_ = State::Ground;
+    std::vector<unsigned> params_;
+    bool private_ = false;
+
+    char32_t cp_ = 0;
+    int utf8_remaining_ = 0;
+
+    std::size_t bytes_ = 0;
+    std::size_t escapes_ = 0;
+};
+
+
+inline void VirtualTerminal::put(char ch) {
+    auto byte = std::uint8_t(ch);
+
+    switch (state_) {
+        case State::Ground:
+            break;
+
+        case State::Escape:
+            if (byte == '[') {
+                state_ = State::Csi;
+                params_.assign(1, 0);
+                private_ = false;
+            } else if (byte == ']') {
+                state_ = State::Osc;
+            } else {
+                // RIS: full reset
+                if (byte == 'c') {
+                    cells_.assign(cells_.size(), VirtualCell());
+                    cursor_ = {};
+                    attr_ = VirtualCell();
+                }
+                state_ = State::Ground;
+            }
+            return;
+
+        case State::Csi:
+            if (byte >= '0' && byte <= '9') {
+                params_.back() = params_.back()*10 + (byte - '0');
+            } else if (byte == ';') {
+                params_.push_back(0);
+            } else if (byte >= 0x3C && byte <= 0x3F) {
+                private_ = true;
+            } else if (byte >= 0x40 && byte <= 0x7E) {
+                state_ = State::Ground;
+                if (!private_)
+                    csi(char(byte));
+            }
+            return;
+
+        case State::Osc:
+            if (byte == 0x07)
+                state_ = State::Ground;
+            else if (byte == 0x1B)
+                state_ = State::OscEscape;
+            return;
+
+        case State::OscEscape:
+            state_ = (byte == '\\') ? State::Ground : State::Osc;
+            return;
+    }
+
+    if (utf8_remaining_) {
+        if (detail::utf8_seq_cont(byte)) {
+            cp_ = (cp_ << 6) | (byte & detail::utf8_cont_mask);
+            if (!--utf8_remaining_)
+                print(cp_);
+            return;
+        }
+
+        // Truncated sequence
+        utf8_remaining_ = 0;
+        print(U'\uFFFD');
+    }
+
+    if (byte >= 0x80) {
+        auto len = detail::utf8_seq_length(byte);
+        if (len > 1) {
+            cp_ = byte & detail::utf8_start_masks[len];
+            utf8_remaining_ = len - 1;
+        } else {
+            print(U'\uFFFD');
+        }
+        return;
+    }
+
+    switch (byte) {
+        case 0x1B:
+            ++escapes_;
+            state_ = State::Escape;
+            break;
+        case '\n':
+            cursor_.x = 0;
+            line_feed();
+            break;
+        case '\r':
+            cursor_.x = 0;
+            break;
+        case '\b':
+            cursor_.x = utils::max(cursor_.x - 1, Coord(0));
+            break;
+        case '\t':
+            cursor_.x = utils::min((cursor_.x/8 + 1)*8, size_.x - 1);
+            break;
+        default:
+            if (byte >= 0x20 && byte != 0x7F)
+                print(byte);
+            break;
+    }
+}
+
+inline void VirtualTerminal::print(char32_t cp) {
+    auto width = Coord(detail::wcwidth(cp));
+
+    // Combining characters are not represented
+    if (!width)
+        return;
+
+    // Wide characters never straddle lines
+    if (cursor_.x + width > size_.x) {
+        cursor_.x = 0;
+        line_feed();
+    }
+
+    auto& c = at(cursor_.x, cursor_.y);
+    c = attr_;
+    c.glyph = cp;
+
+    if (width > 1 && cursor_.x + 1 < size_.x) {
+        auto& right = at(cursor_.x + 1, cursor_.y);
+        right = attr_;
+        right.glyph = 0;
+    }
+
+    cursor_.x += width;
+}
+
+inline void VirtualTerminal::line_feed() {
+    if (cursor_.y + 1 < size_.y) {
+        ++cursor_.y;
+        return;
+    }
+
+    std::move(cells_.begin() + size_.x, cells_.end(), cells_.begin());
+    erase(size_.y - 1, 0, size_.x);
+}
+
+inline void VirtualTerminal::erase(Coord y, Coord from, Coord to) {
+    from = utils::clamp(from, Coord(0), size_.x);
+    to = utils::clamp(to, Coord(0), size_.x);
+
+    auto b = blank();
+    for (auto x = from; x < to; ++x)
+        at(x, y) = b;
+}
+
+inline void VirtualTerminal::csi(char final) {
+    // Pending wrap is not emulated: the cursor stays in the last column
+    auto clamp_x = [this](Coord x) { return utils::clamp(x, Coord(0), size_.x - 1); };
+    auto clamp_y = [this](Coord y) { return utils::clamp(y, Coord(0), size_.y - 1); };
+
+    switch (final) {
+        case 'm':
+            sgr();
+            break;
+        case 'H':
+        case 'f':
+            cursor_ = { clamp_x(param(1, 1) - 1), clamp_y(param(0, 1) - 1) };
+            break;
+        case 'A':
+            cursor_.y = clamp_y(cursor_.y - param(0, 1));
+            break;
+        case 'B':
+            cursor_.y = clamp_y(cursor_.y + param(0, 1));
+            break;
+        case 'C':
+            cursor_.x = clamp_x(cursor_.x + param(0, 1));
+            break;
+        case 'D':
+            cursor_.x = clamp_x(cursor_.x - param(0, 1));
+            break;
+        case 'G':
+            cursor_.x = clamp_x(param(0, 1) - 1);
+            break;
+        case 'K':
+            switch (param(0, 0)) {
+                case 0: erase(cursor_.y, cursor_.x, size_.x); break;
+                case 1: erase(cursor_.y, 0, cursor_.x + 1); break;
+                case 2: erase(cursor_.y, 0, size_.x); break;
+            }
+            break;
+        case 'J':
+            switch (param(0, 0)) {
+                case 0:
+                    erase(cursor_.y, cursor_.x, size_.x);
+                    for (auto y = cursor_.y + 1; y < size_.y; ++y)
+                        erase(y, 0, size_.x);
+                    break;
+                case 1:
+                    for (Coord y = 0; y < cursor_.y; ++y)
+                        erase(y, 0, size_.x);
+                    erase(cursor_.y, 0, cursor_.x + 1);
+                    break;
+                case 2:
+                case 3:
+                    for (Coord y = 0; y < size_.y; ++y)
+                        erase(y, 0, size_.x);
+                    break;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+inline void VirtualTerminal::sgr() {
+    auto extended = [this](std::size_t& i) {
+        VirtualColor color;
+
+        if (i + 2 < params_.size() && params_[i + 1] == 5) {
+            color = { VirtualColor::Kind::Indexed, params_[i + 2] & 0xFF };
+            i += 2;
+        } else if (i + 4 < params_.size() && params_[i + 1] == 2) {
+            color = { VirtualColor::Kind::Rgb, ((params_[i + 2] & 0xFF) << 16) |
+                                               ((params_[i + 3] & 0xFF) << 8) |
+                                               (params_[i + 4] & 0xFF) };
+            i += 4;
+        } else {
+            // Malformed: ignore the rest of the sequence
+            i = params_.size();
+        }
+
+        return color;
+    };
+
+    for (std::size_t i = 0; i < params_.size(); ++i) {
+        auto p = params_[i];
+
+        if (p == 0) {
+            attr_ = VirtualCell();
+        } else if (p == 1) {
+            attr_.bold = true;
+        } else if (p == 22) {
+            attr_.bold = false;
+        } else if (p >= 30 && p <= 37) {
+            attr_.foreground = { VirtualColor::Kind::Indexed, p - 30 };
+        } else if (p == 38) {
+            attr_.foreground = extended(i);
+        } else if (p == 39) {
+            attr_.foreground = VirtualColor();
+        } else if (p >= 40 && p <= 47) {
+            attr_.background = { VirtualColor::Kind::Indexed, p - 40 };
+        } else if (p == 48) {
+            attr_.background = extended(i);
+        } else if (p == 49) {
+            attr_.background = VirtualColor();
+        } else if (p >= 90 && p <= 97) {
+            attr_.foreground = { VirtualColor::Kind::Indexed, p - 90 + 8 };
+        } else if (p >= 100 && p <= 107) {
+            attr_.background = { VirtualColor::Kind::Indexed, p - 100 + 8 };
+        }
+    }
+}
+
+inline std::size_t VirtualTerminal::difference(VirtualTerminal const& other) const {
+    auto common = Size(utils::min(size_.x, other.size_.x), utils::min(size_.y, other.size_.y));
+    std::size_t count = std::size_t(size_.x*size_.y + other.size_.x*other.size_.y - 2*common.x*common.y);
+
+    for (Coord y = 0; y < common.y; ++y) {
+        for (Coord x = 0; x < common.x; ++x)
+            count += cell({ x, y }) != other.cell({ x, y });
+    }
+
+    return count;
+}
+
+namespace detail
+{
+    inline void append_utf8(std::string& out, char32_t cp) {
+        if (cp < 0x80) {
+            out += char(cp);
+        } else if (cp < 0x800) {
+            out += char(0xC0 | (cp >> 6));
+            out += char(0x80 | (cp & 0x3F));
+        } else if (cp < 0x10000) {
+            out += char(0xE0 | (cp >> 12));
+            out += char(0x80 | ((cp >> 6) & 0x3F));
+            out += char(0x80 | (cp & 0x3F));
+        } else {
+            out += char(0xF0 | (cp >> 18));
+            out += char(0x80 | ((cp >> 12) & 0x3F));
+            out += char(0x80 | ((cp >> 6) & 0x3F));
+            out += char(0x80 | (cp & 0x3F));
+        }
+    }
+
+    inline void append_virtual_color(std::string& out, VirtualColor const& color) {
+        switch (color.kind) {
+            case VirtualColor::Kind::Default:
+                out += "default";
+                break;
+            case VirtualColor::Kind::Indexed:
+                out += std::to_string(color.value);
+                break;
+            case VirtualColor::Kind::Rgb: {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "#%06x", unsigned(color.value));
+                out += buf;
+                break;
+            }
+        }
+    }
+} /* namespace detail */
+
+inline std::string VirtualTerminal::dump() const {
+    std::string out;
+
+    for (Coord y = 0; y < size_.y; ++y) {
+        for (Coord x = 0; x < size_.x; ++x) {
+            auto glyph = cell({ x, y }).glyph;
+            if (glyph)
+                detail::append_utf8(out, glyph);
+        }
+        out += '\n';
+    }
+
+    for (Coord y = 0; y < size_.y; ++y) {
+        for (Coord x = 0; x < size_.x;) {
+            auto const& first = cell({ x, y });
+
+            auto end = x + 1;
+            while (end < size_.x) {
+                auto const& c = cell({ end, y });
+                if (c.foreground != first.foreground || c.background != first.background || c.bold != first.bold)
+                    break;
+                ++end;
+            }
+
+            out += std::to_string(y) + ':' + std::to_string(x) + '-' + std::to_string(end - 1) + " fg=";
+            detail::append_virtual_color(out, first.foreground);
+            out += " bg=";
+            detail::append_virtual_color(out, first.background);
+            if (first.bold)
+                out += " bold";
+            out += '\n';
+
+            x = end;
+        }
+    }
+
+    return out;
+}
+
+} /* namespace plot */
@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+
+import sys
+
+# Palette matches are looked up in tables indexed by color quantized to
+# QUANTIZATION_BITS bits per channel: (r << 2*bits) | (g << bits) | b.
+# Entries hold the palette index perceptually nearest (in OKLab) to the
+# center of their bin.
+QUANTIZATION_BITS = 5
+LEVELS = 1 << QUANTIZATION_BITS
+
+# Standard VGA colors, as in ansi::detail::palette
+ANSI16 = [
+    (0, 0, 0), (170, 0, 0), (0, 170, 0), (170, 85, 0),
+    (0, 0, 170), (170, 0, 170), (0, 170, 170), (170, 170, 170),
+    (85, 85, 85), (255, 85, 85), (85, 255, 85), (255, 255, 85),
+    (85, 85, 255), (255, 85, 255), (85, 255, 255), (255, 255, 255),
+]
+
+CUBE = [0, 95, 135, 175, 215, 255]
+
+
+def color256(i):
+    """Entry i of the xterm 256 color palette."""
+    if i < 16:
+        return ANSI16[i]
+
+    if i >= 0xe8:
+        gray = 8 + 10*(i - 0xe8)
+        return (gray, gray, gray)
+
+    i -= 16
+    return (CUBE[i // 36], CUBE[(i // 6) % 6], CUBE[i % 6])
+
+
+def srgb_to_linear(x):
+    return x/12.92 if x <= 0.04045 else ((x + 0.055)/1.055)**2.4
+
+
+def cbrt(x):
+    return x**(1.0/3.0) if x >= 0 else -(-x)**(1.0/3.0)
+
+
+def to_oklab(r, g, b):
+    """From linear RGB."""
+    l = cbrt(0.4122214708*r + 0.5363325363*g + 0.0514459929*b)
+    m = cbrt(0.2119034982*r + 0.6806995451*g + 0.1073969566*b)
+    s = cbrt(0.0883024619*r + 0.2817188376*g + 0.6299787005*b)
+
+    return (0.2104542553*l + 0.7936177850*m - 0.0040720468*s,
+            1.9779984951*l - 2.4285922050*m + 0.4505937099*s,
+            0.0259040371*l + 0.7827717662*m - 0.8086757660*s)
+
+
+def quantization_table(colors):
+    entries = [to_oklab(*(srgb_to_linear(c/255.0) for c in color256(i)))
+               for i in range(colors)]
+    linear = [srgb_to_linear(i/(LEVELS - 1)) for i in range(LEVELS)]
+
+    table = []
+    for r in range(LEVELS):
+        for g in range(LEVELS):
+            for b in range(LEVELS):
+                L, A, B = to_oklab(linear[r], linear[g], linear[b])
+                best, best_dist = 0, None
+                for j, (l, a, b_) in enumerate(entries):
+                    dist = (l - L)**2 + (a - A)**2 + (b_ - B)**2
+                    if best_dist is None or dist < best_dist:
+                        best, best_dist = j, dist
+                table.append(best)
+
+    return table
+
+
+def render_table(table, indent, per_line=32):
+    lines = []
+
+    for start in range(0, len(table), per_line):
+        lines.append(' ' * indent + ','.join(
+            str(v) for v in table[start:start + per_line]) + ',')
+
+    return '\n'.join(lines)
+
+
+if __name__ == '__main__':
+    print("Generating color tables", file=sys.stderr)
+
+    ansi16 = render_table(quantization_table(16), 8)
+    ansi256 = render_table(quantization_table(256), 8)
+
+    print("Rendering header", file=sys.stderr)
+    with open('color_data_template.hpp') as template:
+        for line in template:
+            print(line.format(bits=QUANTIZATION_BITS, size=LEVELS**3,
+                              ansi16=ansi16, ansi256=ansi256), end='')
+
+    print("Done.", file=sys.stderr)
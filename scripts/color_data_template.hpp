@@ -0,0 +1,74 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * GENERATED BY scripts/color.py: DO NOT EDIT
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace plot
+{{
+
+namespace ansi
+{{
+
+namespace detail
+{{
+    // Template variables struct members should be linked only once
+    // though appearing in multiple translation units
+    template<typename = void>
+    struct color_tables {{
+        // Colors are quantized to quantization_bits per channel; tables are
+        // indexed by (r << 2*quantization_bits) | (g << quantization_bits) | b
+        // and hold the palette entry nearest in OKLab to the center of each bin
+        static constexpr std::size_t quantization_bits = {bits};
+
+        // Nearest of the 16 standard colors
+        static const std::uint8_t ansi16[{size}];
+
+        // Nearest of the xterm 256 color palette
+        static const std::uint8_t ansi256[{size}];
+    }};
+
+    template<typename T>
+    constexpr std::size_t color_tables<T>::quantization_bits;
+
+    template<typename T>
+    const std::uint8_t color_tables<T>::ansi16[{size}] = {{
+{ansi16}
+    }};
+
+    template<typename T>
+    const std::uint8_t color_tables<T>::ansi256[{size}] = {{
+{ansi256}
+    }};
+}} /* namespace detail */
+
+}} /* namespace ansi */
+
+}} /* namespace plot */
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+
+import sys
+
+# 3x5 pixel font for printable ASCII (U+0020..U+007E). Lowercase letters
+# share uppercase shapes. Each glyph is drawn in a 4x8 pixel box,
+# that is 2x2 Braille cells: one blank row above, two below and one blank
+# column on the right.
+GLYPHS = {
+    ' ': ('...', '...', '...', '...', '...'),
+    '!': ('.#.', '.#.', '.#.', '...', '.#.'),
+    '"': ('#.#', '#.#', '...', '...', '...'),
+    '#': ('#.#', '###', '#.#', '###', '#.#'),
+    '$': ('.##', '##.', '.#.', '.##', '##.'),
+    '%': ('#..', '..#', '.#.', '#..', '..#'),
+    '&': ('.#.', '#.#', '.#.', '#.#', '.##'),
+    "'": ('.#.', '.#.', '...', '...', '...'),
+    '(': ('..#', '.#.', '.#.', '.#.', '..#'),
+    ')': ('#..', '.#.', '.#.', '.#.', '#..'),
+    '*': ('...', '#.#', '.#.', '#.#', '...'),
+    '+': ('...', '.#.', '###', '.#.', '...'),
+    ',': ('...', '...', '...', '.#.', '#..'),
+    '-': ('...', '...', '###', '...', '...'),
+    '.': ('...', '...', '...', '...', '.#.'),
+    '/': ('..#', '..#', '.#.', '#..', '#..'),
+    '0': ('###', '#.#', '#.#', '#.#', '###'),
+    '1': ('.#.', '##.', '.#.', '.#.', '###'),
+    '2': ('###', '..#', '###', '#..', '###'),
+    '3': ('###', '..#', '###', '..#', '###'),
+    '4': ('#.#', '#.#', '###', '..#', '..#'),
+    '5': ('###', '#..', '###', '..#', '###'),
+    '6': ('###', '#..', '###', '#.#', '###'),
+    '7': ('###', '..#', '..#', '.#.', '.#.'),
+    '8': ('###', '#.#', '###', '#.#', '###'),
+    '9': ('###', '#.#', '###', '..#', '###'),
+    ':': ('...', '.#.', '...', '.#.', '...'),
+    ';': ('...', '.#.', '...', '.#.', '#..'),
+    '<': ('..#', '.#.', '#..', '.#.', '..#'),
+    '=': ('...', '###', '...', '###', '...'),
+    '>': ('#..', '.#.', '..#', '.#.', '#..'),
+    '?': ('###', '..#', '.#.', '...', '.#.'),
+    '@': ('###', '#.#', '#.#', '#..', '###'),
+    'A': ('.#.', '#.#', '###', '#.#', '#.#'),
+    'B': ('##.', '#.#', '##.', '#.#', '##.'),
+    'C': ('.##', '#..', '#..', '#..', '.##'),
+    'D': ('##.', '#.#', '#.#', '#.#', '##.'),
+    'E': ('###', '#..', '##.', '#..', '###'),
+    'F': ('###', '#..', '##.', '#..', '#..'),
+    'G': ('.##', '#..', '#.#', '#.#', '.##'),
+    'H': ('#.#', '#.#', '###', '#.#', '#.#'),
+    'I': ('###', '.#.', '.#.', '.#.', '###'),
+    'J': ('..#', '..#', '..#', '#.#', '.#.'),
+    'K': ('#.#', '#.#', '##.', '#.#', '#.#'),
+    'L': ('#..', '#..', '#..', '#..', '###'),
+    'M': ('#.#', '###', '###', '#.#', '#.#'),
+    'N': ('##.', '#.#', '#.#', '#.#', '#.#'),
+    'O': ('.#.', '#.#', '#.#', '#.#', '.#.'),
+    'P': ('##.', '#.#', '##.', '#..', '#..'),
+    'Q': ('.#.', '#.#', '#.#', '##.', '.##'),
+    'R': ('##.', '#.#', '##.', '#.#', '#.#'),
+    'S': ('.##', '#..', '.#.', '..#', '##.'),
+    'T': ('###', '.#.', '.#.', '.#.', '.#.'),
+    'U': ('#.#', '#.#', '#.#', '#.#', '###'),
+    'V': ('#.#', '#.#', '#.#', '#.#', '.#.'),
+    'W': ('#.#', '#.#', '###', '###', '#.#'),
+    'X': ('#.#', '#.#', '.#.', '#.#', '#.#'),
+    'Y': ('#.#', '#.#', '.#.', '.#.', '.#.'),
+    'Z': ('###', '..#', '.#.', '#..', '###'),
+    '[': ('##.', '#..', '#..', '#..', '##.'),
+    '\\': ('#..', '#..', '.#.', '..#', '..#'),
+    ']': ('.##', '..#', '..#', '..#', '.##'),
+    '^': ('.#.', '#.#', '...', '...', '...'),
+    '_': ('...', '...', '...', '...', '###'),
+    '`': ('#..', '.#.', '...', '...', '...'),
+    '{': ('..#', '.#.', '##.', '.#.', '..#'),
+    '|': ('.#.', '.#.', '.#.', '.#.', '.#.'),
+    '}': ('#..', '.#.', '.##', '.#.', '#..'),
+    '~': ('...', '.##', '##.', '...', '...'),
+}
+
+FIRST = 0x20
+LAST = 0x7E
+
+GLYPH_COLS = 3
+GLYPH_ROWS = 5
+# Offset of the glyph inside its 4x8 box
+GLYPH_TOP = 1
+
+# Unicode braille patterns: bit of each dot in a 2x4 cell, by [x][y]
+PIXEL_CODES = ((0x01, 0x02, 0x04, 0x40), (0x08, 0x10, 0x20, 0x80))
+
+
+def glyph(ch):
+    rows = GLYPHS.get(ch) or GLYPHS[ch.upper()]
+
+    if len(rows) != GLYPH_ROWS or any(len(r) != GLYPH_COLS for r in rows):
+        raise ValueError("invalid glyph {!r}".format(ch))
+
+    return rows
+
+
+def row_masks(rows):
+    """One byte per row, bit 2 is the leftmost pixel."""
+    return [sum(1 << (GLYPH_COLS - 1 - x) for x, px in enumerate(row)
+                if px == '#') for row in rows]
+
+
+def cell_masks(rows):
+    """Braille masks of the 2x2 cells covering the glyph box:
+    top-left, top-right, bottom-left, bottom-right."""
+    cells = [0, 0, 0, 0]
+
+    for y, row in enumerate(rows):
+        for x, px in enumerate(row):
+            if px != '#':
+                continue
+
+            by = y + GLYPH_TOP
+            cell = (by // 4)*2 + x // 2
+            cells[cell] |= PIXEL_CODES[x % 2][by % 4]
+
+    return cells
+
+
+def render_table(entries, indent):
+    lines = []
+
+    for cp, values in entries:
+        lines.append(' ' * indent + '{{ {} }}, // {}'.format(
+            ', '.join('0x{:02x}'.format(v) for v in values),
+            repr(chr(cp))))
+
+    return '\n'.join(lines)
+
+
+if __name__ == '__main__':
+    print("Generating font tables", file=sys.stderr)
+
+    chars = [(cp, glyph(chr(cp))) for cp in range(FIRST, LAST + 1)]
+
+    glyphs = render_table([(cp, row_masks(g)) for cp, g in chars], 8)
+    cells = render_table([(cp, cell_masks(g)) for cp, g in chars], 8)
+
+    print("Rendering header", file=sys.stderr)
+    with open('font_data_template.hpp') as template:
+        for line in template:
+            print(line.format(glyphs=glyphs, cells=cells), end='')
+
+    print("Done.", file=sys.stderr)
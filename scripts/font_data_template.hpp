@@ -0,0 +1,62 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/**
+ * GENERATED BY scripts/font.py: DO NOT EDIT
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace plot
+{{
+
+namespace detail
+{{
+    // Template variables struct members should be linked only once
+    // though appearing in multiple translation units
+    template<typename = void>
+    struct font_tables {{
+        // 3x5 glyphs for U+0020..U+007E, one byte per row,
+        // bit 2 is the leftmost pixel
+        static const std::uint8_t glyphs[][5];
+
+        // Braille masks of each glyph drawn in a 4x8 pixel box:
+        // top-left, top-right, bottom-left and bottom-right cells
+        static const std::uint8_t cells[][4];
+    }};
+
+    template<typename T>
+    const std::uint8_t font_tables<T>::glyphs[][5] = {{
+{glyphs}
+    }};
+
+    template<typename T>
+    const std::uint8_t font_tables<T>::cells[][4] = {{
+{cells}
+    }};
+}} /* namespace detail */
+
+}} /* namespace plot */
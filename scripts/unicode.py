@@ -184,6 +184,75 @@ def render_tree(tree, var, indent):
     return output[:-1]  # Remove last newline
 
 
+def build_width_table(zero_width, double_width, page_bits=8):
+    """Build a two-stage lookup table of 2-bit code point widths.
+
+    The first stage maps each page of 2**page_bits code points to a leaf;
+    identical leaves are stored once. Each leaf byte packs the widths
+    of four consecutive code points, lowest bits first.
+    """
+    widths = bytearray(b'\x01') * (UC_END + 1)
+
+    for intv in double_width:
+        widths[intv.start:intv.end + 1] = b'\x02' * len(intv)
+
+    for intv in zero_width:
+        widths[intv.start:intv.end + 1] = b'\x00' * len(intv)
+
+    page_size = 1 << page_bits
+    pages = []
+    leaves = []
+    leaf_index = {}
+
+    for page_start in range(0, UC_END + 1, page_size):
+        page = widths[page_start:page_start + page_size]
+        leaf = bytes(
+            page[i] | (page[i + 1] << 2) | (page[i + 2] << 4) | (page[i + 3] << 6)
+            for i in range(0, page_size, 4))
+
+        if leaf not in leaf_index:
+            leaf_index[leaf] = len(leaves)
+            leaves.append(leaf)
+
+        pages.append(leaf_index[leaf])
+
+    if len(leaves) > 256:
+        raise ValueError("too many distinct leaves ({}) for 8-bit page table"
+                         .format(len(leaves)))
+
+    return pages, b''.join(leaves)
+
+
+def verify_width_table(pages, leaves, zero_width, double_width, page_bits=8):
+    leaf_size = (1 << page_bits) // 4
+
+    def lookup(cp):
+        byte = leaves[pages[cp >> page_bits]*leaf_size +
+                      ((cp & ((1 << page_bits) - 1)) >> 2)]
+        return (byte >> ((cp & 3)*2)) & 3
+
+    for intv in double_width:
+        for cp in (intv.start, intv.center, intv.end):
+            if not any(cp in zw for zw in zero_width) and lookup(cp) != 2:
+                raise ValueError("wrong width for U+{:04X}".format(cp))
+
+    for intv in zero_width:
+        for cp in (intv.start, intv.center, intv.end):
+            if lookup(cp) != 0:
+                raise ValueError("wrong width for U+{:04X}".format(cp))
+
+
+def render_bytes(data, indent, per_line=16):
+    lines = []
+
+    for i in range(0, len(data), per_line):
+        lines.append(' ' * indent +
+                     ', '.join('0x{:02x}'.format(b)
+                               for b in data[i:i + per_line]) + ',')
+
+    return '\n'.join(lines)[:-1]  # Remove last comma
+
+
 def parse_db_entry(entry):
     sep = entry.find(';')
 
@@ -283,6 +352,8 @@ if __name__ == '__main__':
         if prev < UC_END:
             remove_interval(zero_width, Interval(prev + 1, UC_END))
 
+    zero_width_intervals = zero_width
+
     print("Building zero-width search tree", file=sys.stderr)
     zero_width = build_tree(zero_width)
 
@@ -321,6 +392,8 @@ if __name__ == '__main__':
         if prev < UC_END:
             remove_interval(double_width, Interval(prev + 1, UC_END))
 
+    double_width_intervals = double_width
+
     print("Building double-width search tree", file=sys.stderr)
     double_width = build_tree(double_width)
 
@@ -332,11 +405,26 @@ if __name__ == '__main__':
     print("Generating C code for double-width search tree", file=sys.stderr)
     double_width = render_tree(double_width, 'unicode_tables<T>::double_width', 8)
 
+    print("Building two-stage width table", file=sys.stderr)
+    width_pages, width_leaves = build_width_table(zero_width_intervals,
+                                                  double_width_intervals)
+
+    print("Verifying table... ", end='', file=sys.stderr)
+    verify_width_table(width_pages, width_leaves,
+                       zero_width_intervals, double_width_intervals)
+    print("OK ({} pages, {} distinct leaves, {} bytes)"
+          .format(len(width_pages), len(width_leaves) // 64,
+                  len(width_pages) + len(width_leaves)), file=sys.stderr)
+
+    width_pages = render_bytes(width_pages, 8)
+    width_leaves = render_bytes(width_leaves, 8)
+
     print("Rendering header", file=sys.stderr)
     with open('unicode_data_template.hpp') as template:
         for line in template:
             print(
-                line.format(zero_width=zero_width, double_width=double_width),
+                line.format(zero_width=zero_width, double_width=double_width,
+                            width_pages=width_pages, width_leaves=width_leaves),
                 end='')
 
     print("Done.", file=sys.stderr)
@@ -46,6 +46,8 @@
 
 #include "unicode_structs.hpp"
 
+#include <cstdint>
+
 namespace plot
 {{
 
@@ -57,6 +59,12 @@ namespace detail
     struct unicode_tables {{
         static const unicode_interval_tree_t zero_width[];
         static const unicode_interval_tree_t double_width[];
+
+        // Two-stage width table: width_pages maps each page of 256
+        // code points to a 64 byte leaf in width_leaves; each leaf byte
+        // packs the 2-bit widths of four code points, lowest bits first
+        static const std::uint8_t width_pages[];
+        static const std::uint8_t width_leaves[];
     }};
 
     template<typename T>
@@ -68,6 +76,16 @@ namespace detail
     const unicode_interval_tree_t unicode_tables<T>::double_width[] = {{
 {double_width}
     }};
+
+    template<typename T>
+    const std::uint8_t unicode_tables<T>::width_pages[] = {{
+{width_pages}
+    }};
+
+    template<typename T>
+    const std::uint8_t unicode_tables<T>::width_leaves[] = {{
+{width_leaves}
+    }};
 }} /* namespace detail */
 
 }} /* namespace plot */
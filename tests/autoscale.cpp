@@ -0,0 +1,156 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "plot.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+using namespace plot;
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #cond "\n"; \
+            ++failures; \
+        } \
+    } while (0)
+
+static bool finite(Rectf const& r) {
+    return std::isfinite(r.p1.x) && std::isfinite(r.p1.y) &&
+           std::isfinite(r.p2.x) && std::isfinite(r.p2.y);
+}
+
+static bool contains(Rectf const& bounds, Rectf const& data) {
+    auto b = bounds.sorted();
+    auto d = data.sorted();
+    return b.p1.x <= d.p1.x && b.p1.y <= d.p1.y && d.p2.x <= b.p2.x && d.p2.y <= b.p2.y;
+}
+
+static void test_running_bounds() {
+    RunningBounds running;
+    CHECK(running.empty());
+
+    std::vector<Pointf> points = { { 1.0f, -2.0f }, { -3.0f, 4.0f }, { 0.5f, 0.5f } };
+    running.add(points.begin(), points.end());
+    CHECK(!running.empty());
+    CHECK(running.bounds() == Rectf({ -3.0f, -2.0f }, { 1.0f, 4.0f }));
+
+    running.add({ 10.0f, 10.0f });
+    CHECK(running.bounds() == Rectf({ -3.0f, -2.0f }, { 10.0f, 10.0f }));
+
+    running.clear();
+    CHECK(running.empty());
+}
+
+static void test_window_bounds() {
+    WindowBounds window(3);
+    CHECK(window.empty());
+
+    // Extrema leave the window three points after they were added
+    window.add({ 0.0f, 10.0f }).add({ 1.0f, -10.0f }).add({ 2.0f, 0.0f });
+    CHECK(window.bounds() == Rectf({ 0.0f, -10.0f }, { 2.0f, 10.0f }));
+
+    window.add({ 3.0f, 1.0f });
+    CHECK(window.bounds() == Rectf({ 1.0f, -10.0f }, { 3.0f, 1.0f }));
+
+    window.add({ 4.0f, 2.0f });
+    CHECK(window.bounds() == Rectf({ 2.0f, 0.0f }, { 4.0f, 2.0f }));
+
+    // Compare with a brute force window over a longer sequence
+    WindowBounds long_window(16);
+    std::vector<Pointf> points;
+    for (int i = 0; i < 200; ++i) {
+        Pointf p(float((i*37) % 101), float((i*59) % 67) - 30.0f);
+        points.push_back(p);
+        long_window.add(p);
+
+        auto first = points.size() > 16 ? points.end() - 16 : points.begin();
+        CHECK(long_window.bounds() == RunningBounds(first, points.end()).bounds());
+    }
+
+    long_window.clear();
+    CHECK(long_window.empty());
+}
+
+template<typename Canvas>
+static void test_apply(Canvas canvas, Rectf const& data) {
+    Autoscale scale;
+    auto initial = canvas.bounds();
+
+    // No data yet: nothing to fit
+    CHECK(!scale.apply(canvas, RunningBounds()));
+    CHECK(!scale.apply(canvas, WindowBounds(8)));
+    CHECK(canvas.bounds() == initial);
+
+    RunningBounds running;
+    running.add(data.p1).add(data.p2);
+    CHECK(scale.apply(canvas, running));
+    CHECK(finite(canvas.bounds()));
+    CHECK(contains(canvas.bounds(), data));
+
+    // Orientation is preserved
+    CHECK((canvas.bounds().p1.y > canvas.bounds().p2.y) == (initial.p1.y > initial.p2.y));
+
+    // Same data again: hysteresis keeps the bounds
+    auto fitted = canvas.bounds();
+    CHECK(!scale.apply(canvas, running));
+    CHECK(canvas.bounds() == fitted);
+}
+
+static void test_apply_non_finite() {
+    RealCanvas<BrailleCanvas, Log10Scale, Log10Scale> canvas({ { 1.0f, 100.0f }, { 100.0f, 1.0f } }, Size(20, 5));
+    Autoscale scale;
+    auto inf = std::numeric_limits<float>::infinity(),
+         nan = std::numeric_limits<float>::quiet_NaN();
+
+    CHECK(!scale.apply(canvas, Rectf({ 1.0f, 1.0f }, { inf, 10.0f })));
+    CHECK(!scale.apply(canvas, Rectf({ 1.0f, nan }, { 10.0f, 10.0f })));
+    CHECK(canvas.bounds() == Rectf({ 1.0f, 100.0f }, { 100.0f, 1.0f }));
+
+    // Disabled axes are not checked
+    scale.axes(false, true);
+    CHECK(scale.apply(canvas, Rectf({ nan, 1000.0f }, { nan, 10000.0f })));
+    CHECK(canvas.bounds().p1.x == 1.0f && canvas.bounds().p2.x == 100.0f);
+}
+
+int main() {
+    test_running_bounds();
+    test_window_bounds();
+
+    test_apply(RealCanvas<BrailleCanvas>({ { 0.0f, 1.0f }, { 1.0f, 0.0f } }, Size(20, 5)),
+               Rectf({ -5.0f, 2.0f }, { 5.0f, 30.0f }));
+    test_apply(RealCanvas<BrailleCanvas, Log10Scale, Log10Scale>({ { 1.0f, 10.0f }, { 10.0f, 1.0f } }, Size(20, 5)),
+               Rectf({ 0.5f, 3.0f }, { 5000.0f, 1e6f }));
+    test_apply_non_finite();
+
+    if (failures)
+        std::cerr << failures << " checks failed\n";
+
+    return failures != 0;
+}
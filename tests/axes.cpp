@@ -0,0 +1,135 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "plot.hpp"
+
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace plot;
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #cond "\n"; \
+            ++failures; \
+        } \
+    } while (0)
+
+static void test_nice_ticks() {
+    using detail::nice_step;
+    using detail::nice_ticks;
+
+    auto ticks = nice_ticks(0.0f, 1.0f, 0.2f, 10);
+    CHECK(ticks.size() == 6);
+    CHECK(!ticks.empty() && ticks.front() == 0.0f);
+    CHECK(!ticks.empty() && std::abs(ticks.back() - 1.0f) < 1e-6f);
+
+    // At most max_count ticks
+    CHECK(nice_ticks(0.0f, 1000.0f, 1.0f, 10).size() == 10);
+
+    // Bad steps and bounds yield no ticks
+    auto inf = std::numeric_limits<float>::infinity(),
+         nan = std::numeric_limits<float>::quiet_NaN();
+    CHECK(nice_ticks(0.0f, 1.0f, 0.0f, 10).empty());
+    CHECK(nice_ticks(0.0f, 1.0f, -0.5f, 10).empty());
+    CHECK(nice_ticks(0.0f, 1.0f, nan, 10).empty());
+    CHECK(nice_ticks(0.0f, 1.0f, inf, 10).empty());
+    CHECK(nice_ticks(nan, 1.0f, 0.2f, 10).empty());
+    CHECK(nice_ticks(0.0f, inf, 0.2f, 10).empty());
+    CHECK(nice_ticks(1.0f, 0.0f, 0.2f, 10).empty());
+
+    // Multipliers past 2^24 (e.g. epoch timestamps): a float loop
+    // counter used to stop advancing and never end
+    auto step = nice_step(256.0f, 8);
+    ticks = nice_ticks(1e9f, 1e9f + 256.0f, step, 9);
+    CHECK(!ticks.empty() && ticks.size() <= 9);
+    for (auto t: ticks)
+        CHECK(t >= 1e9f - step && t <= 1e9f + 256.0f + step);
+}
+
+static void test_axes_layout() {
+    // Layout with huge bounds terminates and yields labels
+    RealCanvas<BrailleCanvas> canvas({ { 1e9f, 1e9f + 256.0f }, { 1e9f + 256.0f, 1e9f } }, Size(40, 10));
+    auto ax = plot::axes(&canvas);
+    auto const& layout = ax.layout();
+    CHECK(!layout.xticks.empty());
+    CHECK(!layout.yticks.empty());
+    CHECK(layout.label_width > 0);
+}
+
+static void test_axes_resize_invalidates() {
+    // Wider labels widen the axes: parent layouts must notice
+    RealCanvas<BrailleCanvas> canvas({ { 0.0f, 1.0f }, { 1.0f, 0.0f } }, Size(40, 10));
+    auto ax = plot::axes(&canvas);
+    auto box = vbox(&ax);
+
+    auto before = box.size();
+    CHECK(before == ax.size());
+
+    // Ask the parent first: its cached geometry must not be stale
+    canvas.bounds({ { 0.0f, 100000.0f }, { 1.0f, 0.0f } });
+    auto after = box.size();
+    CHECK(after.x > before.x);
+    CHECK(after == ax.size());
+}
+
+static void test_screen_keeps_diffing() {
+    // New bounds with labels of the same width move no region:
+    // the next update only writes changed lines
+    RealCanvas<BrailleCanvas> canvas({ { 0.0f, 1.0f }, { 1.0f, 0.0f } }, Size(20, 4));
+    auto ax = plot::axes(&canvas);
+    TerminalInfo term;
+    term.mode = TerminalMode::Ansi;
+    Screen screen(ax, term);
+
+    std::ostringstream full, diff;
+    screen.render(full);
+    canvas.bounds({ { 0.0f, 1.0f }, { 2.0f, 0.0f } });
+    screen.update(diff);
+
+    // Only the x labels changed
+    std::ostringstream labels;
+    labels << term.move_to({ 1, 5 });
+    CHECK(diff.str().find(labels.str()) == 0);
+    CHECK(diff.str().size() < full.str().size());
+}
+
+int main() {
+    test_nice_ticks();
+    test_axes_layout();
+    test_axes_resize_invalidates();
+    test_screen_keeps_diffing();
+
+    if (failures)
+        std::cerr << failures << " checks failed\n";
+
+    return failures != 0;
+}
@@ -0,0 +1,163 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "plot.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace plot;
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #cond "\n"; \
+            ++failures; \
+        } \
+    } while (0)
+
+static TerminalInfo terminal(TerminalMode mode) {
+    TerminalInfo term;
+    term.mode = mode;
+    term.background_color = { 0, 0, 0, 1 };
+    return term;
+}
+
+static VirtualColor rgb(int r, int g, int b) {
+    return { VirtualColor::Kind::Rgb, std::uint32_t((r << 16) | (g << 8) | b) };
+}
+
+// Equal up to one unit of rounding per channel
+static bool near(VirtualColor const& c1, VirtualColor const& c2) {
+    if (c1.kind != c2.kind)
+        return false;
+
+    for (int shift: { 0, 8, 16 }) {
+        if (std::abs(int((c1.value >> shift) & 0xFF) - int((c2.value >> shift) & 0xFF)) > 1)
+            return false;
+    }
+
+    return true;
+}
+
+static std::size_t count(std::string const& str, std::string const& what) {
+    std::size_t n = 0;
+    for (auto pos = str.find(what); pos != std::string::npos; pos = str.find(what, pos + 1))
+        ++n;
+    return n;
+}
+
+static void render(VirtualTerminal& vt, BrailleCanvas const& canvas) {
+    std::ostream stream(&vt);
+    stream << canvas;
+}
+
+static void test_background_compositing() {
+    BrailleCanvas canvas({ 8, 1 }, terminal(TerminalMode::Iso24bit));
+    canvas.fill_backgrounds(true);
+
+    auto all = [](Point) { return true; };
+
+    // Opaque background on cells 0-3, translucent on cells 2-5
+    canvas.fill({ 1, 0, 0, 1 }, Rect({ 0, 0 }, { 7, 3 }), all)
+          .fill({ 0, 0, 1, 0.5f }, Rect({ 4, 0 }, { 11, 3 }), all);
+
+    // Strokes over backgrounds stay visible
+    canvas.dot({ 0, 1, 0, 1 }, { 0, 0 })
+          .dot({ 0, 1, 0, 1 }, { 4, 0 });
+
+    // Opaque backgrounds hide pixels below them
+    canvas.dot({ 0, 1, 0, 1 }, { 12, 0 })
+          .fill({ 1, 1, 0, 1 }, Rect({ 12, 0 }, { 13, 3 }), all);
+
+    VirtualTerminal vt({ 8, 2 });
+    render(vt, canvas);
+
+    auto red = rgb(255, 0, 0), green = rgb(0, 255, 0), yellow = rgb(255, 255, 0);
+
+    CHECK(vt.cell({ 0, 0 }).glyph == U'⠁');
+    CHECK(vt.cell({ 0, 0 }).foreground == green);
+    CHECK(vt.cell({ 0, 0 }).background == red);
+
+    CHECK(vt.cell({ 1, 0 }).glyph == U' ');
+    CHECK(vt.cell({ 1, 0 }).background == red);
+
+    // Translucent blue over red
+    CHECK(vt.cell({ 2, 0 }).glyph == U'⠁');
+    CHECK(vt.cell({ 2, 0 }).foreground == green);
+    CHECK(near(vt.cell({ 2, 0 }).background, rgb(128, 0, 128)));
+    CHECK(near(vt.cell({ 3, 0 }).background, rgb(128, 0, 128)));
+
+    // Translucent blue over the canvas background
+    CHECK(near(vt.cell({ 4, 0 }).background, rgb(0, 0, 128)));
+    CHECK(near(vt.cell({ 5, 0 }).background, rgb(0, 0, 128)));
+
+    CHECK(vt.cell({ 6, 0 }).glyph == U' ');
+    CHECK(vt.cell({ 6, 0 }).background == yellow);
+
+    CHECK(vt.cell({ 7, 0 }).background == VirtualColor());
+}
+
+static void test_sgr_coalescing() {
+    // A run of cells with the same colors takes one SGR sequence
+    auto term = terminal(TerminalMode::Iso24bit);
+    BrailleCanvas canvas({ 16, 1 }, term);
+    canvas.fill_backgrounds(true)
+          .fill({ 0, 0, 1, 1 }, Rect({ 0, 0 }, { 31, 3 }), [](Point) { return true; })
+          .line({ 1, 0, 0, 1 }, { 0, 0 }, { 31, 0 });
+
+    std::ostringstream stream;
+    stream << canvas;
+    auto out = stream.str();
+
+    std::ostringstream reset;
+    reset << term.reset();
+    CHECK(count(out, "\x1b[") == count(out, reset.str()) + 2);
+    CHECK(count(out, "\x1b[38;2;255;0;0;48;2;0;0;255m") == 1);
+
+    // Colors matching the same palette entry take one sequence too
+    BrailleCanvas palette_canvas({ 16, 1 }, terminal(TerminalMode::Ansi256));
+    for (Coord x = 0; x < 32; ++x)
+        palette_canvas.dot({ 1.0f - 0.001f*float(x), 0, 0, 1 }, { x, 0 });
+
+    VirtualTerminal vt({ 16, 2 });
+    render(vt, palette_canvas);
+    CHECK(vt.escapes() <= 4);
+    for (Coord x = 0; x < 16; ++x)
+        CHECK(vt.cell({ x, 0 }).foreground == vt.cell({ 0, 0 }).foreground);
+}
+
+int main() {
+    test_background_compositing();
+    test_sgr_coalescing();
+
+    if (failures)
+        std::cerr << failures << " checks failed\n";
+
+    return failures != 0;
+}
@@ -0,0 +1,109 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "plot.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using namespace plot;
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #cond "\n"; \
+            ++failures; \
+        } \
+    } while (0)
+
+static_assert(std::is_nothrow_move_constructible<AnyBlock>::value, "AnyBlock moves must not throw");
+static_assert(std::is_nothrow_move_assignable<AnyBlock>::value, "AnyBlock moves must not throw");
+
+static std::string render(AnyBlock const& block) {
+    std::ostringstream stream;
+    stream << block;
+    return stream.str();
+}
+
+template<typename Block>
+static void test_moved_from(Block const& block) {
+    AnyBlock a(block);
+    auto expected = render(a);
+    CHECK(a.size() == detail::block_traits<Block>::size(block));
+
+    // Leave a cursor open in the source of the move
+    std::ostringstream stream;
+    stream << *a.begin();
+
+    AnyBlock b(std::move(a));
+    CHECK(render(b) == expected);
+
+    // Moved-from blocks are empty, but usable
+    CHECK(a.size() == Size());
+    CHECK(!a.resize({ 4, 4 }));
+    CHECK(render(a).empty());
+
+    AnyBlock c(a);
+    CHECK(c.size() == Size());
+
+    AnyBlock d(std::move(a));
+    CHECK(d.size() == Size());
+
+    // Assignment to and from moved-from blocks
+    a = std::move(b);
+    CHECK(render(a) == expected);
+    CHECK(b.size() == Size());
+
+    b = a;
+    CHECK(render(b) == expected);
+
+    a = std::move(d);
+    CHECK(a.size() == Size());
+
+    a = std::move(a);
+    CHECK(a.size() == Size());
+    b = std::move(b);
+    CHECK(render(b) == expected);
+}
+
+int main() {
+    // Stored inline
+    test_moved_from(Label("moved", 12));
+
+    // Stored on the heap
+    BrailleCanvas canvas({ 10, 3 });
+    canvas.line(palette::red, { 0, 0 }, { 19, 11 });
+    static_assert(sizeof(BrailleCanvas) > detail::any_buffer_size, "canvas should not fit inline");
+    test_moved_from(canvas);
+
+    if (failures)
+        std::cerr << failures << " checks failed\n";
+
+    return failures != 0;
+}
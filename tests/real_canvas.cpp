@@ -0,0 +1,117 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "plot.hpp"
+
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace plot;
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #cond "\n"; \
+            ++failures; \
+        } \
+    } while (0)
+
+template<typename Block>
+static std::string render(Block const& block) {
+    std::ostringstream stream;
+    stream << block;
+    return stream.str();
+}
+
+static void test_round_coord() {
+    using detail::round_coord;
+
+    auto inf = std::numeric_limits<float>::infinity(),
+         nan = std::numeric_limits<float>::quiet_NaN();
+    auto limit = detail::coord_limit;
+
+    CHECK(round_coord(0.49f) == 0);
+    CHECK(round_coord(0.5f) == 1);
+    CHECK(round_coord(-0.5f) == -1);
+    CHECK(round_coord(-1.49f) == -1);
+
+    // Clamped far outside any canvas instead of undefined conversions
+    CHECK(round_coord(1e30f) == limit);
+    CHECK(round_coord(-1e30f) == -limit);
+    CHECK(round_coord(inf) == limit);
+    CHECK(round_coord(-inf) == -limit);
+    CHECK(round_coord(nan) == -limit);
+}
+
+static void test_scatter_non_finite() {
+    auto inf = std::numeric_limits<float>::infinity(),
+         nan = std::numeric_limits<float>::quiet_NaN();
+    Rectf bounds({ 0.0f, 1.0f }, { 1.0f, 0.0f });
+
+    std::vector<Pointf> finite = { { 0.1f, 0.2f }, { 0.5f, 0.5f }, { 0.9f, 0.7f } };
+    std::vector<Pointf> points = {
+        { nan, 0.5f }, { 0.5f, nan }, { nan, nan },
+        { inf, 0.5f }, { -inf, 0.5f }, { 0.5f, inf }, { 0.5f, -inf },
+        { 1e30f, 0.5f }, { -1e30f, 0.5f }, { 0.5f, 1e30f }, { 1e30f, -1e30f }
+    };
+    points.insert(points.begin() + 3, finite.begin(), finite.end());
+
+    // Non-finite and out of range points are skipped
+    RealCanvas<BrailleCanvas> expected(bounds, Size(10, 4)), canvas(bounds, Size(10, 4));
+    expected.scatter(palette::red, finite.begin(), finite.end());
+    canvas.scatter(palette::red, points.begin(), points.end());
+    CHECK(render(canvas) == render(expected));
+
+    canvas.clear();
+    expected.clear();
+    for (auto const& p: finite)
+        expected.dot(palette::red, p);
+    for (auto const& p: points)
+        canvas.dot(palette::red, p);
+    CHECK(render(canvas) == render(expected));
+
+    // Lines towards clamped points are clipped to the canvas
+    canvas.clear()
+          .line(palette::red, { 0.5f, 0.5f }, { 1e30f, 0.5f })
+          .line(palette::red, { 0.5f, 0.5f }, { 0.5f, -inf });
+    expected.clear()
+            .line(palette::red, { 0.5f, 0.5f }, { 2.0f, 0.5f })
+            .line(palette::red, { 0.5f, 0.5f }, { 0.5f, -1.0f });
+    CHECK(render(canvas) == render(expected));
+}
+
+int main() {
+    test_round_coord();
+    test_scatter_non_finite();
+
+    if (failures)
+        std::cerr << failures << " checks failed\n";
+
+    return failures != 0;
+}
@@ -0,0 +1,163 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "plot.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace plot;
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #cond "\n"; \
+            ++failures; \
+        } \
+    } while (0)
+
+// Fixed-seed generator, the same on every standard library
+class Random {
+public:
+    int operator()(int n) {
+        state_ = state_*6364136223846793005ull + 1442695040888963407ull;
+        return int((state_ >> 33) % std::uint64_t(n));
+    }
+
+    float unit() {
+        return float((*this)(256))/255.0f;
+    }
+
+private:
+    std::uint64_t state_ = 12345;
+};
+
+static std::string render(BrailleCanvas const& canvas) {
+    std::ostringstream stream;
+    stream << canvas;
+    return stream.str();
+}
+
+// Shapes are composited as a whole, through a scratch layer: drawing
+// one must give the same result as drawing it on a pushed layer.
+// Layer pushes, pops and resizes in between exercise reuse of the
+// scratch layer. Only braille patterns are compared: a shape drawn
+// on a layer is composited twice, and colors round differently.
+static void test_shapes_match_layers() {
+    Random random;
+    TerminalInfo term;
+    term.mode = TerminalMode::None;
+
+    TerminalOp const ops[] = { TerminalOp::Over, TerminalOp::ClipDst, TerminalOp::ClipSrc };
+
+    int mismatches = 0;
+    for (int iteration = 0; iteration < 300; ++iteration) {
+        Size sz(10 + random(30), 3 + random(12));
+        BrailleCanvas shapes(sz, term), layers(sz, term);
+
+        auto backgrounds = random(2) != 0;
+        shapes.fill_backgrounds(backgrounds);
+        layers.fill_backgrounds(backgrounds);
+
+        int depth = 0;
+        for (int step = 0; step < 16; ++step) {
+            auto size = shapes.size();
+            auto point = [&]() {
+                return Point(random(int(size.x) + 10) - 5, random(int(size.y) + 10) - 5);
+            };
+
+            Color color(random.unit(), random.unit(), random.unit(), random(2) ? 1.0f : random.unit());
+            Color fill(random.unit(), random.unit(), random.unit(), random.unit());
+            auto op = ops[random(3)];
+            Point a = point(), b = point(), c = point();
+
+            auto action = random(9);
+            switch (action) {
+                case 0:
+                    shapes.rect(color, Rect(a, b), op);
+                    layers.push().rect(color, Rect(a, b)).pop(op);
+                    break;
+                case 1:
+                    shapes.rect(color, fill, Rect(a, b), op);
+                    layers.push().rect(color, fill, Rect(a, b)).pop(op);
+                    break;
+                case 2:
+                    shapes.ellipse(color, Rect(a, b), op);
+                    layers.push().ellipse(color, Rect(a, b)).pop(op);
+                    break;
+                case 3:
+                    shapes.ellipse(color, fill, Rect(a, b), op);
+                    layers.push().ellipse(color, fill, Rect(a, b)).pop(op);
+                    break;
+                case 4:
+                    shapes.path(color, { a, b, c, a }, op);
+                    layers.push().path(color, { a, b, c, a }).pop(op);
+                    break;
+                case 5:
+                    shapes.fill(fill, Rect(a, b), [](Point) { return true; }, op);
+                    layers.fill(fill, Rect(a, b), [](Point) { return true; }, op);
+                    break;
+                case 6:
+                    shapes.push();
+                    layers.push();
+                    ++depth;
+                    break;
+                case 7:
+                    shapes.pop(op);
+                    layers.pop(op);
+                    depth -= (depth > 0);
+                    break;
+                case 8: {
+                    Size to(10 + random(30), 3 + random(12));
+                    shapes.resize(to);
+                    layers.resize(to);
+                    break;
+                }
+            }
+        }
+
+        for (; depth > 0; --depth) {
+            shapes.pop();
+            layers.pop();
+        }
+
+        if (render(shapes) != render(layers))
+            ++mismatches;
+    }
+
+    CHECK(mismatches == 0);
+}
+
+int main() {
+    test_shapes_match_layers();
+
+    if (failures)
+        std::cerr << failures << " checks failed\n";
+
+    return failures != 0;
+}
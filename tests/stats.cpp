@@ -0,0 +1,121 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+// Built with PLOT_ENABLE_STATS defined, see CMakeLists.txt
+#include "plot.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+using namespace plot;
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #cond "\n"; \
+            ++failures; \
+        } \
+    } while (0)
+
+#ifndef PLOT_ENABLE_STATS
+#error "test_stats must be built with PLOT_ENABLE_STATS"
+#endif
+
+static_assert(std::is_same<BrailleCanvas, stats_on::BrailleCanvas>::value,
+              "canvases with statistics must be distinct entities");
+static_assert(std::is_same<TiledCanvas, stats_on::TiledCanvas>::value,
+              "canvases with statistics must be distinct entities");
+
+template<typename T>
+static std::string str(T const& value) {
+    std::ostringstream stream;
+    stream << value;
+    return stream.str();
+}
+
+static void test_draw_stats() {
+    BrailleCanvas canvas({ 4, 2 });
+    auto const& stats = canvas.stats();
+
+    // One paint per cell touched
+    canvas.dot(palette::red, { 0, 0 })
+          .dot(palette::red, { 1, 1 })
+          .dot(palette::red, { 7, 7 });
+    CHECK(stats.cells_painted == 3);
+
+    // Scatter paints each cell once, however many points hit it
+    canvas.scatter(palette::red, { { 0, 0 }, { 1, 0 }, { 0, 1 }, { 2, 0 }, { 100, 100 } });
+    CHECK(stats.cells_painted == 5);
+
+    canvas.push().push().pop().pop().pop();
+    CHECK(stats.layers_pushed == 2);
+    CHECK(stats.layers_popped == 2);
+
+    canvas.clear_stats();
+    CHECK(stats.cells_painted == 0);
+    CHECK(stats.layers_pushed == 0);
+    CHECK(stats.draw_time.count() == 0);
+}
+
+static void test_render_stats() {
+    TerminalInfo term;
+    term.mode = TerminalMode::Iso24bit;
+
+    BrailleCanvas canvas({ 4, 2 }, term);
+    canvas.dot(palette::red, { 0, 0 })
+          .dot(palette::red, { 2, 0 })
+          .dot(palette::blue, { 0, 4 });
+    canvas.clear_stats();
+
+    auto out = str(canvas);
+    auto const& stats = canvas.stats();
+
+    CHECK(stats.lines_rendered == 2);
+
+    // Two adjacent red cells share one sequence
+    CHECK(stats.escapes == 2);
+
+    // Everything but the reset and bold sequences around each
+    // line, and line feeds, is cell content
+    auto framing = 2*str(term.reset()).size() + str(term.bold()).size() + 1;
+    CHECK(stats.bytes == out.size() - 2*framing);
+
+    str(canvas);
+    CHECK(stats.lines_rendered == 4);
+    CHECK(stats.bytes == 2*(out.size() - 2*framing));
+}
+
+int main() {
+    test_draw_stats();
+    test_render_stats();
+
+    if (failures)
+        std::cerr << failures << " checks failed\n";
+
+    return failures != 0;
+}
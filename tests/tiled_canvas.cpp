@@ -0,0 +1,268 @@
+/**
+ * The MIT License
+ *
+ * Copyright (c) 2017 Fabio Massaioli
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "plot.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace plot;
+
+static int failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #cond "\n"; \
+            ++failures; \
+        } \
+    } while (0)
+
+// Fixed-seed generator, the same on every standard library
+class Random {
+public:
+    int operator()(int n) {
+        state_ = state_*6364136223846793005ull + 1442695040888963407ull;
+        return int((state_ >> 33) % std::uint64_t(n));
+    }
+
+    float unit() {
+        return float((*this)(256))/255.0f;
+    }
+
+private:
+    std::uint64_t state_ = 99;
+};
+
+static std::string render(BrailleCanvas const& canvas) {
+    std::ostringstream stream;
+    stream << canvas;
+    return stream.str();
+}
+
+// Tiles are allocated only when painted on, not when a drawing
+// operation's bounding box overlaps them
+static void test_sparse_allocation() {
+    Size size(10000, 200);
+    Coord cols = (size.x + TiledCanvas::tile_cols - 1)/TiledCanvas::tile_cols,
+          rows = (size.y + TiledCanvas::tile_lines - 1)/TiledCanvas::tile_lines;
+    Color white(1, 1, 1);
+    Point far(2*size.x - 1, 4*size.y - 1);
+
+    // A diagonal crosses at most one tile per row and column boundary
+    TiledCanvas diagonal(size);
+    diagonal.line(white, { 0, 0 }, far);
+    CHECK(diagonal.allocated_tiles() <= std::size_t(cols + rows - 1));
+
+    diagonal.push().line(white, { 0, 0 }, far).pop();
+    CHECK(diagonal.allocated_tiles() <= std::size_t(cols + rows - 1));
+
+    // Outlines allocate the tiles on the border only
+    TiledCanvas outline(size);
+    outline.rect(white, { { 0, 0 }, far });
+    CHECK(outline.allocated_tiles() == std::size_t(2*(cols + rows) - 4));
+
+    outline.path(white, { { 0, 0 }, { far.x, 0 }, far, { 0, far.y }, { 0, 0 } });
+    CHECK(outline.allocated_tiles() == std::size_t(2*(cols + rows) - 4));
+
+    TiledCanvas ellipse(size);
+    ellipse.ellipse(white, { { 0, 0 }, far });
+    CHECK(ellipse.allocated_tiles() < std::size_t(cols*rows/2));
+
+    // Operations painting nothing allocate nothing
+    TiledCanvas empty(size);
+    empty.clear({ { 0, 0 }, far })
+         .line(white, { -10, -10 }, { -1, 4*size.y })
+         .fill(white, { { 0, 0 }, far }, [](Point) { return false; });
+    CHECK(empty.allocated_tiles() == 0);
+
+    // Filled shapes do allocate every tile they cover
+    TiledCanvas filled(size);
+    filled.rect(white, white, { { 0, 0 }, far });
+    CHECK(filled.allocated_tiles() == std::size_t(cols*rows));
+}
+
+// Randomized drawing on a tiled canvas and on a single BrailleCanvas:
+// the tiled canvas viewed in full, or through a window, must give the
+// same cells
+static void test_matches_braille_canvas() {
+    Random random;
+    TerminalInfo term;
+    term.mode = TerminalMode::Ansi256;
+
+    TerminalOp const ops[] = { TerminalOp::Over, TerminalOp::ClipDst, TerminalOp::ClipSrc };
+
+    int mismatches = 0, window_mismatches = 0;
+    for (int iteration = 0; iteration < 200; ++iteration) {
+        Size sz(1 + random(300), 1 + random(40));
+        BrailleCanvas single(sz, term);
+        TiledCanvas tiled(sz);
+
+        auto backgrounds = random(2) != 0;
+        single.fill_backgrounds(backgrounds);
+        tiled.fill_backgrounds(backgrounds);
+
+        for (int step = 0; step < 20; ++step) {
+            auto size = single.size();
+            auto point = [&]() {
+                return Point(random(int(size.x) + 20) - 10, random(int(size.y) + 20) - 10);
+            };
+
+            Color color(random.unit(), random.unit(), random.unit(), random(2) ? 1.0f : random.unit());
+            Color fill(random.unit(), random.unit(), random.unit(), random.unit());
+            auto op = ops[random(3)];
+            Point a = point(), b = point(), c = point();
+
+            switch (random(13)) {
+                case 0:
+                    single.rect(color, Rect(a, b), op);
+                    tiled.rect(color, Rect(a, b), op);
+                    break;
+                case 1:
+                    single.rect(color, fill, Rect(a, b), op);
+                    tiled.rect(color, fill, Rect(a, b), op);
+                    break;
+                case 2:
+                    single.ellipse(color, Rect(a, b), op);
+                    tiled.ellipse(color, Rect(a, b), op);
+                    break;
+                case 3:
+                    single.ellipse(color, fill, Rect(a, b), op);
+                    tiled.ellipse(color, fill, Rect(a, b), op);
+                    break;
+                case 4:
+                    single.path(color, { a, b, c, a }, op);
+                    tiled.path(color, { a, b, c, a }, op);
+                    break;
+                case 5:
+                    single.line(color, a, b, op);
+                    tiled.line(color, a, b, op);
+                    break;
+                case 6:
+                    single.dot(color, a, op);
+                    tiled.dot(color, a, op);
+                    break;
+                case 7: {
+                    std::vector<Point> points;
+                    for (int i = 0; i < 50; ++i)
+                        points.push_back(point());
+
+                    single.scatter(color, points.begin(), points.end(), op);
+                    tiled.scatter(color, points.begin(), points.end(), op);
+                    break;
+                }
+                case 8:
+                    single.text(color, a, "Hi\nxy", op);
+                    tiled.text(color, a, "Hi\nxy", op);
+                    break;
+                case 9: {
+                    Rect inside{ { 0, 0 }, size - Point(1, 1) };
+                    Rect rct(a.clamp(inside.p1, inside.p2), b.clamp(inside.p1, inside.p2));
+                    single.clear(rct);
+                    tiled.clear(rct);
+                    break;
+                }
+                case 10:
+                    single.push();
+                    tiled.push();
+                    break;
+                case 11:
+                    single.pop(op);
+                    tiled.pop(op);
+                    break;
+                case 12: {
+                    auto pattern = [](Point p) { return (p.x*7 + p.y*3) % 5 < 2; };
+                    single.fill(color, Rect(a, b), pattern, op);
+                    tiled.fill(color, Rect(a, b), pattern, op);
+
+                    auto band = [c](Coord x) { return std::make_pair(Coord(x/3 + c.y), Coord(x/2 + c.y - 5)); };
+                    single.stroke(fill, Rect(b, c), band, op);
+                    tiled.stroke(fill, Rect(b, c), band, op);
+                    break;
+                }
+            }
+
+            if (random(10) == 0) {
+                Size to(1 + random(300), 1 + random(40));
+                single.resize(to);
+                tiled.resize(to);
+            }
+        }
+
+        auto char_sz = single.char_size();
+        BrailleCanvas full(char_sz, term);
+        if (render(single) != render(tiled.view(full, { 0, 0 })))
+            ++mismatches;
+
+        // Cells of a window match those of the full view, and are
+        // empty outside the canvas. Foreground colors of blank cells
+        // are not significant.
+        Point origin(random(int(char_sz.x) + 10) - 5, random(int(char_sz.y) + 10) - 5);
+        BrailleCanvas window({ 1 + random(80), 1 + random(30) }, term);
+        tiled.view(window, origin);
+
+        // One more line: the trailing newline scrolls
+        VirtualTerminal full_vt(char_sz + Size(0, 1)), window_vt(window.char_size() + Size(0, 1));
+        {
+            std::ostream full_stream(&full_vt), window_stream(&window_vt);
+            full_stream << full << std::flush;
+            window_stream << window << std::flush;
+        }
+
+        bool same = true;
+        for (Coord y = 0; y < window.char_size().y; ++y) {
+            for (Coord x = 0; x < window.char_size().x; ++x) {
+                auto p = origin + Point(x, y);
+                auto const& cell = window_vt.cell({ x, y });
+
+                if (p.x < 0 || p.y < 0 || p.x >= char_sz.x || p.y >= char_sz.y) {
+                    same = same && cell.glyph == U' ';
+                    continue;
+                }
+
+                auto const& expected = full_vt.cell(p);
+                same = same && cell.glyph == expected.glyph && cell.background == expected.background &&
+                       (cell.glyph == U' ' || cell.foreground == expected.foreground);
+            }
+        }
+
+        window_mismatches += !same;
+    }
+
+    CHECK(mismatches == 0);
+    CHECK(window_mismatches == 0);
+}
+
+int main() {
+    test_sparse_allocation();
+    test_matches_braille_canvas();
+
+    if (failures)
+        std::cerr << failures << " checks failed\n";
+
+    return failures != 0;
+}